@@ -1,6 +1,10 @@
 import os
+import re
+import subprocess
+import sys
+from fnmatch import fnmatch
 
-from SCons.Script import DefaultEnvironment
+from SCons.Script import COMMAND_LINE_TARGETS, DefaultEnvironment
 
 env = DefaultEnvironment()
 platform = env.PioPlatform()
@@ -63,8 +67,7 @@ env.Append(
         "-ffunction-sections",
         "-fdata-sections",
         "-Wl,-gc-sections",
-        "--specs=nano.specs",
-        "--specs=nosys.specs",
+        # C library specs are added below (board_build.libc)
         "-nostartfiles",
         '-Wl,-Map="%s"' % os.path.join(
             "$BUILD_DIR", os.path.basename(env.subst("${PROJECT_DIR}.map"))),
@@ -72,4 +75,203 @@ env.Append(
 )
 # copy general C/C++ flags to assembler with cpp flags too, except
 # would-be-duplicate last two elements
-env["ASPPFLAGS"].extend(env["CCFLAGS"][:-2]) 
\ No newline at end of file
+env["ASPPFLAGS"].extend(env["CCFLAGS"][:-2]) 
+
+#
+# C library: newlib-nano (default), newlib, picolibc or embedlibc, a lean
+# printf family from misc/libc on top of newlib-nano.
+#
+
+LIBC_CHOICES = ("newlib-nano", "newlib", "picolibc", "embedlibc")
+LIBC_DIR = os.path.join(platform.get_dir(), "misc", "libc")
+
+def has_picolibc(env):
+    try:
+        output = subprocess.run(
+            [env.subst("$CC"), "-print-file-name=picolibc.specs"],
+            capture_output=True, text=True, env=env["ENV"]).stdout.strip()
+    except OSError:
+        return False
+    # GCC prints the plain file name if it doesn't know it
+    return os.path.isabs(output)
+
+def configure_libc(env, libc, float_printf, variant_dir):
+    """Adds the flags for the C library to env and returns the objects it
+    needs from misc/libc. Also used for the libc_report target."""
+    if libc == "picolibc":
+        if not has_picolibc(env):
+            sys.stderr.write(
+                "Error: the toolchain has no picolibc (picolibc.specs), "
+                "use another board_build.libc or a toolchain with picolibc\n")
+            env.Exit(1)
+        # picolibc_glue.c sets up thread local storage before main()
+        linkflags = ["--specs=picolibc.specs", "-Wl,--wrap=main"]
+        if not float_printf:
+            linkflags.append("-DPICOLIBC_INTEGER_PRINTF_SCANF")
+        env.Append(CCFLAGS=["--specs=picolibc.specs"])
+        if not float_printf:
+            env.Append(CPPDEFINES=["PICOLIBC_INTEGER_PRINTF_SCANF"])
+    elif libc == "newlib":
+        # always has floating point printf
+        linkflags = ["--specs=nosys.specs"]
+    else:
+        linkflags = ["--specs=nano.specs", "--specs=nosys.specs"]
+        if libc == "newlib-nano" and float_printf:
+            linkflags.append("-Wl,--undefined=_printf_float")
+    env.Append(LINKFLAGS=linkflags)
+
+    objects = []
+    if libc == "embedlibc":
+        libc_env = env.Clone()
+        if float_printf:
+            libc_env.Append(CPPDEFINES=["EMBEDLIBC_FLOAT_PRINTF"])
+        objects = libc_env.CollectBuildFiles(variant_dir, os.path.join(LIBC_DIR, "embedlibc"))
+    elif libc == "picolibc":
+        objects = env.CollectBuildFiles(variant_dir, os.path.join(LIBC_DIR, "picolibc"))
+    return linkflags, objects
+
+libc = str(board.get("build.libc", "newlib-nano")).lower()
+libc_float_printf = str(board.get("build.libc_float_printf", "no")).lower() in ("1", "yes", "true")
+if libc not in LIBC_CHOICES:
+    sys.stderr.write("Error: unknown board_build.libc = %s, possible values: %s\n" % (
+        libc, ", ".join(LIBC_CHOICES)))
+    env.Exit(1)
+libc_linkflags, libc_objects = configure_libc(
+    env, libc, libc_float_printf, os.path.join("$BUILD_DIR", "libc"))
+env.Append(PIOBUILDFILES=libc_objects)
+# for the libc_report target in main.py
+env.Replace(LIBC=libc, LIBC_FLOAT_PRINTF=libc_float_printf,
+            LIBC_LINKFLAGS=libc_linkflags, LIBC_OBJECTS=libc_objects)
+env.AddMethod(configure_libc, "ConfigureLibc")
+
+#
+# Web assets: the files of board_build.web_assets_dir (e.g. data/www) are
+# minified, gzip-compressed and compiled in as table (web_assets.h). The
+# pages of board_build.web_templates_dir (e.g. data/templates) are split
+# into literal parts and variables. board_build.web_routes (e.g.
+# data/routes.txt) adds routes to the generated perfect-hash route table.
+#
+
+web_assets_dir = str(board.get("build.web_assets_dir", ""))
+web_templates_dir = str(board.get("build.web_templates_dir", ""))
+web_routes = str(board.get("build.web_routes", ""))
+for option, value in (("web_templates_dir", web_templates_dir), ("web_routes", web_routes)):
+    if value and not web_assets_dir:
+        sys.stderr.write("Error: board_build.%s needs board_build.web_assets_dir\n" % option)
+        env.Exit(1)
+if web_assets_dir:
+    web_assets_dir = os.path.join(env.subst("$PROJECT_DIR"), web_assets_dir)
+    if web_templates_dir:
+        web_templates_dir = os.path.join(env.subst("$PROJECT_DIR"), web_templates_dir)
+    if web_routes:
+        web_routes = os.path.join(env.subst("$PROJECT_DIR"), web_routes)
+    for option, path, exists in (("web_assets_dir", web_assets_dir, os.path.isdir),
+                                 ("web_templates_dir", web_templates_dir, os.path.isdir),
+                                 ("web_routes", web_routes, os.path.isfile)):
+        if path and not exists(path):
+            sys.stderr.write("Error: board_build.%s %s does not exist\n" % (option, path))
+            env.Exit(1)
+    sys.path.insert(0, os.path.join(platform.get_dir(), "misc", "scripts"))
+    from gen_web_assets import generate as generate_web_assets
+    web_assets_src = os.path.join(env.subst("$BUILD_DIR"), "web_assets")
+    # cheap and only rewrites changed files, so run it every time
+    try:
+        generate_web_assets(web_assets_dir, web_assets_src,
+                            web_templates_dir or None, web_routes or None)
+    except ValueError as e:
+        sys.stderr.write("Error: %s\n" % e)
+        env.Exit(1)
+    env.Append(CPPPATH=[web_assets_src])
+    env.BuildSources(os.path.join("$BUILD_DIR", "WebAssets"), web_assets_src)
+
+#
+# WCHNET memory: with board_build.wchnet_ram (e.g. 48K) the socket numbers,
+# MSS, TCP window and send descriptors of board_build.wchnet_* are sized for
+# that RAM budget into wchnet_sizes.h, which net_config.h includes for
+# WCHNET_AUTO_SIZE. The default MSS follows ETH_DRIVER in build_flags.
+#
+
+wchnet_options = ("tcp", "tcp_listen", "udp", "ipraw", "mss", "window", "txbufs")
+wchnet_ram = str(board.get("build.wchnet_ram", ""))
+for option in wchnet_options:
+    if board.get("build.wchnet_" + option, "") != "" and not wchnet_ram:
+        sys.stderr.write("Error: board_build.wchnet_%s needs board_build.wchnet_ram\n" % option)
+        env.Exit(1)
+if wchnet_ram:
+    sys.path.insert(0, os.path.join(platform.get_dir(), "misc", "scripts"))
+    from gen_net_config import NetProfile, driver_from_defines, generate as generate_net_config, parse_size, report
+    wchnet_src = os.path.join(env.subst("$BUILD_DIR"), "wchnet_sizes")
+    try:
+        profile = NetProfile(parse_size(wchnet_ram),
+                             driver=driver_from_defines(env.ParseFlags(env.get("BUILD_FLAGS", []))["CPPDEFINES"]))
+        for option in wchnet_options:
+            value = str(board.get("build.wchnet_" + option, ""))
+            if value:
+                setattr(profile, option, int(value))
+        wchnet_sizes = generate_net_config(profile, wchnet_src)
+    except ValueError as e:
+        sys.stderr.write("Error: board_build.wchnet_*: %s\n" % e)
+        env.Exit(1)
+    print(report(wchnet_sizes))
+    env.Append(CPPPATH=[wchnet_src], CPPDEFINES=["WCHNET_AUTO_SIZE"])
+
+# per-function stack usage (*.su files) for the stackreport target
+if "stackreport" in COMMAND_LINE_TARGETS:
+    env.Append(CCFLAGS=["-fstack-usage"])
+
+#
+# Hot code: sources matching board_build.hot_sources are compiled for speed,
+# everything else stays size-optimized.
+#
+
+hot_sources = [p for p in re.split(r"[,\s]+", str(board.get("build.hot_sources", ""))) if p]
+hot_optimization = str(board.get("build.hot_optimization", "-O2"))
+hot_objects = []
+
+def is_hot_source(path):
+    path = os.path.abspath(path)
+    rel_path = os.path.relpath(path, env.subst("$PROJECT_DIR"))
+    return any(
+        fnmatch(path, pattern) or fnmatch(rel_path, pattern) or
+        fnmatch(rel_path.replace(os.sep, "/"), pattern)
+        for pattern in hot_sources
+    )
+
+def hot_code_middleware(env, node):
+    if not is_hot_source(node.srcnode().get_abspath()):
+        return node
+    size_flags = env["CCFLAGS"]
+    obj = env.Object(
+        node, CCFLAGS=[hot_optimization if f == "-Os" else f for f in size_flags])
+    # size-optimized reference object, only used for the size summary
+    ref_obj = env.Object(
+        "%s.size_ref%s" % (node.get_path(), env.subst("$OBJSUFFIX")), node,
+        CCFLAGS=size_flags)
+    hot_objects.append((node.srcnode().get_path(), obj, ref_obj))
+    env.Depends(os.path.join("$BUILD_DIR", "${PROGNAME}${PROGSUFFIX}"), ref_obj)
+    return obj
+
+def get_object_size(path):
+    size_tool = env.WhereIs(env.subst("$SIZETOOL")) or env.subst("$SIZETOOL")
+    output = subprocess.run(
+        [size_tool, path], capture_output=True, text=True, env=env["ENV"]).stdout
+    # Berkeley format: text data bss dec hex filename
+    fields = output.splitlines()[-1].split() if output else []
+    return int(fields[0]) + int(fields[1]) if len(fields) > 2 else 0
+
+def print_hot_code_summary(target, source, env):
+    total_hot = total_ref = 0
+    print("Hot code (%s) size compared to -Os:" % hot_optimization)
+    for src, obj, ref_obj in hot_objects:
+        hot_size = get_object_size(env.Flatten(obj)[0].get_abspath())
+        ref_size = get_object_size(env.Flatten(ref_obj)[0].get_abspath())
+        total_hot += hot_size
+        total_ref += ref_size
+        print("  %-60s %7d bytes (%+d)" % (src, hot_size, hot_size - ref_size))
+    print("  %-60s %7d bytes (%+d)" % ("total", total_hot, total_hot - total_ref))
+
+if hot_sources:
+    env.AddBuildMiddleware(hot_code_middleware)
+    env.AddPostAction(
+        os.path.join("$BUILD_DIR", "${PROGNAME}${PROGSUFFIX}"),
+        env.VerboseAction(print_hot_code_summary, "Calculating hot code size"))
@@ -28,7 +28,6 @@ env.Append(
         join(FRAMEWORK_DIR, freertos_subseries, "include"),
         join(FRAMEWORK_DIR, freertos_subseries, "portable", "Common"),
         join(FRAMEWORK_DIR, freertos_subseries, "portable", "GCC", "RISC-V"),
-        join(FRAMEWORK_DIR, freertos_subseries, "portable", "GCC", "RISC-V", "chip_specific_extensions", "RV32I_PFIC_no_extensions"),
         join(FRAMEWORK_DIR, freertos_subseries, "portable", "MemMang"),
         join(FRAMEWORK_DIR, freertos_subseries),
         # user will likely have the FreeRTOSConfig.h located in the main source directory, so include it for the build too
@@ -42,6 +41,12 @@ env.Append(
     ]
 )
 
+# board_build.fpu (see main.py): the context switch saves the FP registers, too
+if board.get("build.mabi", "") == "ilp32f":
+    env.Append(CPPPATH=[join(platform.get_dir(), "misc", "fpu", "freertos")])
+else:
+    env.Append(CPPPATH=[join(FRAMEWORK_DIR, freertos_subseries, "portable", "GCC", "RISC-V", "chip_specific_extensions", "RV32I_PFIC_no_extensions")])
+
 if chip_series.startswith("ch5"):
     env.Append(CPPDEFINES=[("ENABLE_INTERRUPT_NEST", 1)])
 
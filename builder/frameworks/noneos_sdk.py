@@ -1,6 +1,14 @@
-from os.path import isdir, isfile, join, dirname, realpath
+from os.path import basename, isdir, isfile, join, dirname, realpath, relpath
+from pathlib import Path
 from string import Template
-from SCons.Script import DefaultEnvironment
+from SCons.Script import COMMAND_LINE_TARGETS, DefaultEnvironment
+import glob
+import hashlib
+import json
+import os
+import shutil
+import sys
+import time
 
 env = DefaultEnvironment()
 platform = env.PioPlatform()
@@ -110,27 +118,150 @@ if not board.get("build.ldscript", ""):
 
 libs = []
 
-env.BuildSources(
-    join("$BUILD_DIR", "FrameworkNoneOSCore"),
+# Prebuilt SDK archives can be shared between environments and projects.
+# They only depend on the toolchain, the SDK version and the flags the
+# framework is compiled with, so all of that goes into the cache key.
+# the stack analysis needs the *.su files of all sources, so build everything
+use_sdk_cache = get_flag_value("use_sdk_cache", False) and \
+    "stackreport" not in COMMAND_LINE_TARGETS
+sdk_cache_dir = board.get(
+    "build.sdk_cache_dir",
+    join(env.subst("$PROJECT_CORE_DIR"), ".cache", "ch32v-noneos-sdk"))
+sdk_cache_hits = []
+sdk_cache_saved_secs = 0.0
+
+def get_sdk_cache_key():
+    key_data = {
+        "toolchain": platform.get_package_version("toolchain-riscv"),
+        "sdk": platform.get_package_version("framework-wch-noneos-sdk"),
+        "series": chip_series,
+        "frameworks": sorted(env.get("PIOFRAMEWORK", [])),
+        "build_type": env.GetBuildType(),
+    }
+    # these change include paths and defines after the key is computed
+    for flag in ("use_builtin_startup_file", "use_builtin_system_code",
+                 "use_builtin_debug_code", "cpp_support"):
+        key_data[flag] = get_flag_value(flag, True)
+    # per-file optimization levels (see _bare.py)
+    for option in ("hot_sources", "hot_optimization"):
+        key_data[option] = str(board.get("build.%s" % option, ""))
+    if key_data["use_builtin_startup_file"]:
+        key_data["startup"] = get_startup_filename(board)
+    for var in ("ASFLAGS", "ASPPFLAGS", "CFLAGS", "CCFLAGS", "CXXFLAGS",
+                "CPPDEFINES", "BUILD_UNFLAGS"):
+        key_data[var] = env.subst(str(env.get(var, "")))
+    # include dirs of the project (e.g. "-I src/") and generated ones in the
+    # build dir (web_assets, wchnet_sizes) go in relative to these, so the
+    # same sources give the same key in every project and environment.
+    # Their headers may be picked up by the SDK sources, so the contents of
+    # the headers are part of the key, too.
+    build_dir = realpath(env.subst("$BUILD_DIR"))
+    project_dir = realpath(env.subst("$PROJECT_DIR"))
+    include_dirs = []
+    headers = {}
+    for inc_dir in env.get("CPPPATH", []):
+        inc_dir = realpath(env.subst(str(inc_dir)))
+        for base, name in ((build_dir, "$BUILD_DIR"), (project_dir, "$PROJECT_DIR")):
+            if inc_dir == base or inc_dir.startswith(base + os.sep):
+                key_dir = Path(name, relpath(inc_dir, base)).as_posix()
+                break
+        else:
+            include_dirs.append(inc_dir)
+            continue
+        include_dirs.append(key_dir)
+        if not isdir(inc_dir):
+            continue
+        for header in sorted(glob.glob(join(inc_dir, "*.h"))):
+            with open(header, "rb") as fp:
+                headers["%s/%s" % (key_dir, basename(header))] = hashlib.sha1(fp.read()).hexdigest()
+    key_data["CPPPATH"] = include_dirs
+    key_data["headers"] = headers
+    return hashlib.sha1(
+        json.dumps(key_data, sort_keys=True).encode()).hexdigest()[0:16]
+
+def build_sdk_component(name: str, src_dir: str, src_filter=None, link_whole=False):
+    """Builds a part of the SDK as static library, or takes it from the
+    cache. Components which would otherwise be linked as plain object files
+    (startup, system, ...) are linked as whole archive to keep that behavior."""
+    global sdk_cache_saved_secs
+    if use_sdk_cache:
+        cache_lib = join(sdk_cache_dir, sdk_cache_key, "lib%s.a" % name)
+        cache_meta = join(sdk_cache_dir, sdk_cache_key, "%s.json" % name)
+    if use_sdk_cache and isfile(cache_lib):
+        lib = env.File(cache_lib)
+        sdk_cache_hits.append(name)
+        if isfile(cache_meta):
+            with open(cache_meta) as fp:
+                sdk_cache_saved_secs += json.load(fp).get("build_secs", 0)
+    else:
+        lib = env.BuildLibrary(join("$BUILD_DIR", name), src_dir, src_filter)
+        if use_sdk_cache:
+            build_start = []
+            def _mark_start(target, source, env):
+                if not build_start:
+                    build_start.append(time.time())
+            def _store_in_cache(target, source, env):
+                os.makedirs(dirname(cache_lib), exist_ok=True)
+                # copy under a temporary name first so that parallel builds
+                # never see a half-written archive.
+                tmp_lib = "%s.%d.tmp" % (cache_lib, os.getpid())
+                shutil.copyfile(target[0].get_abspath(), tmp_lib)
+                os.replace(tmp_lib, cache_lib)
+                with open(cache_meta, "w") as fp:
+                    json.dump({"build_secs": round(
+                        time.time() - (build_start or [time.time()])[0], 2)}, fp)
+            for obj in lib[0].sources:
+                env.AddPreAction(obj, _mark_start)
+            env.AddPostAction(lib, _store_in_cache)
+    if link_whole:
+        env.Append(LINKFLAGS=[
+            "-Wl,--whole-archive", env.Flatten([lib])[0].get_abspath(),
+            "-Wl,--no-whole-archive"
+        ])
+        env.Depends(join("$BUILD_DIR", "${PROGNAME}${PROGSUFFIX}"), lib)
+    else:
+        libs.append(lib)
+
+def build_framework_sources(name: str, src_dir: str, src_filter=None):
+    if use_sdk_cache:
+        build_sdk_component(name, src_dir, src_filter, link_whole=True)
+    else:
+        env.BuildSources(join("$BUILD_DIR", name), src_dir, src_filter)
+
+if use_sdk_cache:
+    sdk_cache_key = get_sdk_cache_key()
+
+build_framework_sources(
+    "FrameworkNoneOSCore",
     join(FRAMEWORK_DIR, "Core", chip_series)
 )
 
 if get_flag_value("use_builtin_startup_file", True):
     env.Append(CPPPATH=[join(FRAMEWORK_DIR, "Startup")])
     startup_file_filter = "-<*> +<%s>" % get_startup_filename(board)
-    env.BuildSources(
-        join("$BUILD_DIR", "FrameworkNoneOSStartup"),
+    build_framework_sources(
+        "FrameworkNoneOSStartup",
         join(
             FRAMEWORK_DIR, "Startup"
         ),
         startup_file_filter
     )
 
+# board_build.fpu (see main.py): switch the FPU on in mstatus before
+# SystemInit(), the first C code called by the startup file
+if board.get("build.mabi", "") == "ilp32f" and get_flag_value("use_builtin_startup_file", True):
+    env.Append(LINKFLAGS=["-Wl,--wrap=SystemInit"])
+    libs.append(env.BuildLibrary(
+        join("$BUILD_DIR", "FrameworkFPU"),
+        join(platform.get_dir(), "misc", "fpu"),
+        "-<*> +<fpu_enable.c>"
+    ))
+
 # for clock init etc.
 if get_flag_value("use_builtin_system_code", True) and has_system_code:
     env.Append(CPPPATH=[join(FRAMEWORK_DIR, "System", chip_series)])
-    env.BuildSources(
-        join("$BUILD_DIR", "FrameworkNoneOSSSystem"),
+    build_framework_sources(
+        "FrameworkNoneOSSSystem",
         join(FRAMEWORK_DIR, "System", chip_series)
     )
 
@@ -138,23 +269,49 @@ if get_flag_value("use_builtin_system_code", True) and has_system_code:
 # practically every example needs it. Can be turned of in the platformio.ini.
 if get_flag_value("use_builtin_debug_code", True) and has_debug_code:
     env.Append(CPPPATH=[join(FRAMEWORK_DIR, "Debug", chip_series)])
-    env.BuildSources(
-        join("$BUILD_DIR", "FrameworkNoneOSDebug"),
+    build_framework_sources(
+        "FrameworkNoneOSDebug",
         join(FRAMEWORK_DIR, "Debug", chip_series)
     )
 
 # Auto-compile in empty _init() and _fini() functions for C++ support 
 if get_flag_value("cpp_support", True):
     env.Append(CPPDEFINES=["__PIO_CPP_SUPPORT__"])
-    env.BuildSources(
-        join("$BUILD_DIR", "FrameworkInitFini"),
+    build_framework_sources(
+        "FrameworkInitFini",
         join(FRAMEWORK_DIR, "CPP_Support")
     )
 
-libs.append(env.BuildLibrary(
-    join("$BUILD_DIR", "FrameworkNoneOSVariant"),
+build_sdk_component(
+    "FrameworkNoneOSVariant",
     join(FRAMEWORK_DIR, "Peripheral", chip_series, "src")
-))
+)
+
+if use_sdk_cache:
+    if sdk_cache_hits:
+        print("NoneOS SDK cache: %d hit(s) (%s), ~%.1fs of compilation saved" % (
+            len(sdk_cache_hits), ", ".join(sdk_cache_hits), sdk_cache_saved_secs))
+    else:
+        print("NoneOS SDK cache: no hits, populating %s" % join(sdk_cache_dir, sdk_cache_key))
+
+# Optional register access headers generated from the SVD file of the chip,
+# svd_regs.h (C macros) and svd_regs.hpp (C++). Header-only, so they do not
+# take part in the SDK build and cache above.
+if get_flag_value("use_svd_headers", False):
+    svd_file = join(platform.get_dir(), "misc", "svd", board.get("debug.svd_path", ""))
+    if not isfile(svd_file):
+        sys.stderr.write("Error: No SVD file available for board %s\n" % board.id)
+        env.Exit(-1)
+    scripts_dir = join(platform.get_dir(), "misc", "scripts")
+    svd_headers_dir = join(env.subst("$BUILD_DIR"), "SvdHeaders")
+    svd_header = join(svd_headers_dir, "svd_regs.h")
+    svd_sources = (svd_file, join(scripts_dir, "gen_svd_headers.py"))
+    if not isfile(svd_header) or \
+            os.path.getmtime(svd_header) < max(os.path.getmtime(f) for f in svd_sources):
+        sys.path.insert(0, scripts_dir)
+        from gen_svd_headers import generate as generate_svd_headers
+        generate_svd_headers(svd_file, svd_headers_dir)
+    env.Append(CPPPATH=[svd_headers_dir])
 
 # mandatory for compilation
 if chip_series.startswith("ch57") or chip_series.startswith("ch58") or chip_series.startswith("ch59"):
@@ -59,6 +59,11 @@ else:
         join(FRAMEWORK_DIR, rtthread_subseries, "components", "drivers", "serial"),
     ])
 
+# board_build.fpu (see main.py): libcpu/risc-v/common saves the FP registers
+# in the context switch and interrupt entry with these
+if board.get("build.mabi", "") == "ilp32f":
+    env.Append(CPPDEFINES=["ARCH_RISCV_FPU", "ARCH_RISCV_FPU_S"])
+
 env.BuildSources(
     join("$BUILD_DIR", "FrameworkRTThreadCore"),
     join(FRAMEWORK_DIR, rtthread_subseries)
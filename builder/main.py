@@ -14,6 +14,8 @@
 
 import sys
 import os
+import re
+import subprocess
 from typing import List
 
 from SCons.Script import (
@@ -40,6 +42,7 @@ env.Replace(
     GDB="%s-gdb" % compiler_triple,
     CXX="%s-g++" % compiler_triple,
     OBJCOPY="%s-objcopy" % compiler_triple,
+    OBJDUMP="%s-objdump" % compiler_triple,
     RANLIB="%s-ranlib" % compiler_triple,
     SIZETOOL="%s-size" % compiler_triple,
     ARFLAGS=["rc"],
@@ -54,6 +57,64 @@ env.Replace(
 if env.get("PROGNAME", "program") == "program":
     env.Replace(PROGNAME="firmware")
 
+#
+# Configurable SRAM / flash split (CH32V30x with 256K flash)
+#
+
+# RAM/flash -> value of the SRAM_CODE_MODE bits in the USER option byte
+# (CH32V303xC / CH32V305 / CH32V307 reference manual, FLASH_OBR)
+RAM_FLASH_SPLITS = {
+    "128K/192K": 0,
+    "96K/224K": 1,
+    "64K/256K": 2,
+    "32K/288K": 3,
+}
+ram_flash_split = str(board_config.get("build.ram_flash_split", "")).upper().replace(" ", "")
+sram_code_mode = None
+if ram_flash_split:
+    mcu = board_config.get("build.mcu", "").lower()
+    # only the CH32V30x parts sold with 256K flash have the split, the ones
+    # with 128K (CH32V303xB, CH32V305FB / RB) don't, whatever the name
+    board_flash = int(board_config.get("upload.maximum_size", 0))
+    if not mcu.startswith("ch32v30") or board_flash < 192 * 1024:
+        sys.stderr.write(
+            "Error: board_build.ram_flash_split is not supported for %s (%dK flash), "
+            "only for CH32V30x parts with 256K flash\n" % (mcu, board_flash // 1024))
+        env.Exit(1)
+    if ram_flash_split not in RAM_FLASH_SPLITS:
+        sys.stderr.write(
+            "Error: Unknown board_build.ram_flash_split %s, must be one of %s\n" % (
+                ram_flash_split, ", ".join(RAM_FLASH_SPLITS.keys())))
+        env.Exit(1)
+    sram_code_mode = RAM_FLASH_SPLITS[ram_flash_split]
+    ram_kb, flash_kb = [int(v[:-1]) for v in ram_flash_split.split("/")]
+    # the linker script and the size check are generated from these
+    board_config.update("upload.maximum_ram_size", ram_kb * 1024)
+    board_config.update("upload.maximum_size", flash_kb * 1024)
+
+#
+# Hardware floating point (QingKe V4F: CH32V303 / CH32V305 / CH32V307)
+#
+
+# the boards of these parts carry the hard float variant as
+# build.march_fpu / build.mabi_fpu (see misc/scripts/gen_boarddefs.py)
+if str(board_config.get("build.fpu", "no")).lower() in ("1", "yes", "true"):
+    if not board_config.get("build.march_fpu", ""):
+        sys.stderr.write(
+            "Error: board_build.fpu is not supported for %s (no QingKe V4F core)\n" %
+            board_config.get("build.mcu", ""))
+        env.Exit(1)
+    # the context switch code of the other frameworks doesn't save FP registers
+    unsupported = set(env.get("PIOFRAMEWORK", [])) - {"noneos-sdk", "freertos", "rt-thread"}
+    if unsupported:
+        sys.stderr.write(
+            "Error: board_build.fpu is not supported with framework %s\n" %
+            ", ".join(sorted(unsupported)))
+        env.Exit(1)
+    # everything else (_bare.py, benchmark target) picks up march / mabi from here
+    board_config.update("build.march", board_config.get("build.march_fpu"))
+    board_config.update("build.mabi", board_config.get("build.mabi_fpu"))
+
 env.Append(
     BUILDERS=dict(
         ElfToHex=Builder(
@@ -121,6 +182,164 @@ target_size = env.AddPlatformTarget(
     "Calculate program size",
 )
 
+#
+# Target: Flash / RAM usage report from the linker map file
+#
+
+map_report_cmd = [
+    "\"$PYTHONEXE\"",
+    "\"%s\"" % os.path.join(platform.get_dir(), "misc", "scripts", "map_report.py"),
+    # same file name as given via -Wl,-Map in _bare.py
+    "\"%s\"" % os.path.join("$BUILD_DIR", os.path.basename(env.subst("${PROJECT_DIR}.map"))),
+    "--build-dir", "\"$BUILD_DIR\"",
+    "--top", str(board_config.get("build.size_report_top", 20)),
+    "--json", "\"%s\"" % os.path.join("$BUILD_DIR", "size_report.json"),
+    "--baseline", "\"%s\"" % board_config.get(
+        "build.size_report_baseline",
+        os.path.join("$PROJECT_DIR", "size_baselines", "${PIOENV}.json")),
+]
+env.AddPlatformTarget(
+    "size_report",
+    target_elf,
+    env.VerboseAction(" ".join(map_report_cmd + [
+        "--max-increase", str(board_config.get("build.size_report_max_increase", -1))
+    ]), "Generating size report"),
+    "Size Report",
+    "Flash and RAM usage per section, library, object file and symbol",
+)
+
+env.AddPlatformTarget(
+    "size_report_save",
+    target_elf,
+    env.VerboseAction(" ".join(map_report_cmd + ["--save-baseline"]),
+                      "Saving size report baseline"),
+    "Save Size Baseline",
+    "Store the current size report as baseline for the size_report target",
+)
+
+#
+# Target: Worst-case stack depth per task and interrupt handler
+#
+
+# same default as the generated linker script in noneos_sdk.py
+default_stack_size = 256 if board_config.get("build.mcu", "").lower().startswith("ch32v003") else 2048
+env.AddPlatformTarget(
+    "stackreport",
+    target_elf,
+    env.VerboseAction(" ".join([
+        "\"$PYTHONEXE\"",
+        "\"%s\"" % os.path.join(platform.get_dir(), "misc", "scripts", "stack_report.py"),
+        "\"$SOURCE\"",
+        "--build-dir", "\"$BUILD_DIR\"",
+        "--objdump", "\"%s\"" % (env.WhereIs(env.subst("$OBJDUMP")) or env.subst("$OBJDUMP")),
+        "--tasks", "\"%s\"" % board_config.get("build.stack_report_tasks", ""),
+        "--stack-size", str(board_config.get("build.stack_size", default_stack_size)),
+        "--json", "\"%s\"" % os.path.join("$BUILD_DIR", "stack_report.json"),
+    ]), "Analyzing stack usage"),
+    "Stack Report",
+    "Worst-case stack depth of main, interrupt handlers and tasks",
+)
+
+#
+# Target: Flash / RAM usage with each C library (board_build.libc)
+#
+
+def get_elf_size(path):
+    output = subprocess.run(
+        [env.subst("$SIZETOOL"), "-A", "-d", path],
+        capture_output=True, text=True, env=env["ENV"]).stdout
+    flash = ram = 0
+    for line in output.splitlines():
+        match = re.search(env.subst("$SIZEPROGREGEXP"), line)
+        if match:
+            flash += int(match.group(1))
+        match = re.search(env.subst("$SIZEDATAREGEXP"), line)
+        if match:
+            ram += int(match.group(1))
+    return flash, ram
+
+libc_report_elfs = []
+# only relink when asked for, the variants are not needed for a normal build
+if "libc_report" in COMMAND_LINE_TARGETS and "nobuild" not in COMMAND_LINE_TARGETS \
+        and hasattr(env, "ConfigureLibc"):
+    if env["LIBC"] == "picolibc":
+        # the objects were compiled against the picolibc headers
+        libc_variants = [("picolibc", False), ("picolibc", True)]
+    else:
+        libc_variants = [("newlib-nano", False), ("newlib-nano", True), ("newlib", False),
+                         ("embedlibc", False), ("embedlibc", True)]
+    libc_objects = env.Flatten(env["LIBC_OBJECTS"])
+    app_objects = [o for o in env.Flatten(target_elf)[0].sources if o not in libc_objects]
+    for libc, float_printf in libc_variants:
+        name = libc + ("+float" if float_printf else "")
+        variant_dir = os.path.join("$BUILD_DIR", "libc_report", name)
+        variant_env = env.Clone()
+        variant_env.Replace(LINKFLAGS=[
+            f for f in env["LINKFLAGS"]
+            if f not in env["LIBC_LINKFLAGS"] and not str(f).startswith("-Wl,-Map")])
+        _, variant_objects = variant_env.ConfigureLibc(libc, float_printf, variant_dir)
+        libc_report_elfs.append((name, libc == env["LIBC"] and float_printf == env["LIBC_FLOAT_PRINTF"],
+                                 variant_env.Program(os.path.join(variant_dir, "firmware"),
+                                                     app_objects + variant_objects)))
+
+def print_libc_report(target, source, env):
+    if not libc_report_elfs:
+        print("The libc_report target needs a build with board_build.libc support "
+              "(no framework or a framework based on the NoneOS SDK)")
+        return
+    print("%-20s %12s %12s" % ("C library", "Flash", "RAM"))
+    for name, selected, elf in libc_report_elfs:
+        flash, ram = get_elf_size(env.Flatten(elf)[0].get_abspath())
+        print("%-20s %12d %12d%s" % (name, flash, ram, "  (board_build.libc)" if selected else ""))
+
+env.AddPlatformTarget(
+    "libc_report",
+    [target_elf] + [elf for _, _, elf in libc_report_elfs],
+    env.VerboseAction(print_libc_report, "Linking with each C library"),
+    "C Library Report",
+    "Flash and RAM usage of the firmware with each board_build.libc choice",
+)
+
+#
+# Target: Benchmark kernels under an emulator (no hardware needed)
+#
+
+benchmark_cmd = [
+    "\"$PYTHONEXE\"",
+    "\"%s\"" % os.path.join(platform.get_dir(), "misc", "scripts", "benchmark.py"),
+    "--cc", "\"%s\"" % (env.WhereIs(env.subst("$CC")) or env.subst("$CC")),
+    "--march", board_config.get("build.march"),
+    "--mabi", board_config.get("build.mabi"),
+    "--optimization", board_config.get("build.benchmark_optimization", "-Os"),
+    "--project-benchmarks", "\"%s\"" % os.path.join("$PROJECT_DIR", "benchmark"),
+    "--build-dir", "\"%s\"" % os.path.join("$BUILD_DIR", "benchmark"),
+    "--json", "\"%s\"" % os.path.join("$BUILD_DIR", "benchmark.json"),
+    "--baseline", "\"%s\"" % board_config.get(
+        "build.benchmark_baseline", os.path.join("$PROJECT_DIR", "benchmark_baselines", "${PIOENV}.json")),
+    "--max-regression", str(board_config.get("build.benchmark_max_regression", -1)),
+]
+if board_config.get("build.benchmark_emulator", ""):
+    benchmark_cmd.extend(["--emulator", "\"%s\"" % board_config.get("build.benchmark_emulator")])
+if int(ARGUMENTS.get("PIOVERBOSE", 0)):
+    benchmark_cmd.append("--verbose")
+
+env.AddPlatformTarget(
+    "benchmark",
+    None,
+    env.VerboseAction(" ".join(benchmark_cmd), "Running benchmarks"),
+    "Benchmark",
+    "Run the benchmark kernels under an emulator and compare against the baseline",
+)
+
+env.AddPlatformTarget(
+    "benchmark_save",
+    None,
+    env.VerboseAction(" ".join(benchmark_cmd + ["--save-baseline"]),
+                      "Saving benchmark baseline"),
+    "Save Benchmark Baseline",
+    "Store the current benchmark results as baseline for the benchmark target",
+)
+
 #
 # Target: Upload by default .bin file
 #
@@ -130,6 +349,31 @@ debug_tools = board_config.get("debug.tools", {})
 upload_actions = []
 upload_target = target_elf
 
+# Delta upload: only write the flash sectors that changed since the last
+# upload to the same chip (identified by its unique ID). OpenOCD and
+# minichlink only, wchisp can't write partial images.
+use_delta_upload = str(board_config.get("build.delta_upload", "no")).lower() in ("1", "yes", "true")
+if use_delta_upload and upload_protocol == "isp":
+    print("Warning: board_build.delta_upload is not supported with wchisp, uploading the full image")
+
+def get_delta_upload_cmd(tool: str) -> List[str]:
+    # erase granularity, 1K standard erase on CH32V00x, 4K on the others
+    is_v00x = board_config.get("build.mcu", "").lower().startswith("ch32v00")
+    page_size = board_config.get("build.delta_upload_page_size", 1024 if is_v00x else 4096)
+    cmd = [
+        "\"$PYTHONEXE\"",
+        "\"%s\"" % os.path.join(platform.get_dir(), "misc", "scripts", "delta_upload.py"),
+        "--tool", tool,
+        "--image", "\"$SOURCE\"",
+        "--page-size", str(page_size),
+        "--cache-dir", "\"%s\"" % board_config.get(
+            "build.delta_upload_cache_dir",
+            os.path.join(env.subst("$PROJECT_CORE_DIR"), ".cache", "ch32v-delta-upload")),
+    ]
+    if int(ARGUMENTS.get("PIOVERBOSE", 0)):
+        cmd.append("--verbose")
+    return cmd
+
 if upload_protocol in debug_tools and upload_protocol != "minichlink":
     openocd_args = [
         "-c",
@@ -138,23 +382,46 @@ if upload_protocol in debug_tools and upload_protocol != "minichlink":
     openocd_args.extend(
         debug_tools.get(upload_protocol).get("server").get("arguments", [])
     )
-    openocd_args.extend(
-        [
-            "-c", "init",
-            "-c", "halt",
-            "-c", "program {$SOURCE} verify reset",
-            "-c", "shutdown"
-        ]
-    )
-    env.Replace(
-        UPLOADER="openocd",
-        UPLOADERFLAGS=openocd_args,
-        UPLOADCMD="$UPLOADER $UPLOADERFLAGS",
-    )
+    openocd_args.extend(["-c", "init", "-c", "halt"])
+    # make sure the chip boots with the same SRAM / flash split the firmware
+    # was linked for. Only reprograms the option bytes if they differ.
+    if sram_code_mode is not None:
+        openocd_args.extend([
+            "-f", os.path.join(platform.get_dir(), "misc", "openocd", "ch32v30x_option_bytes.tcl"),
+            "-c", "ch32v30x_set_sram_code_mode %d" % sram_code_mode
+        ])
+    openocd_base_args = list(openocd_args)
+    if use_delta_upload:
+        env.Replace(
+            UPLOADER="openocd",
+            UPLOADERFLAGS=openocd_args,
+            UPLOADCMD=" ".join(get_delta_upload_cmd("openocd") + [
+                # the wch_riscv flash bank and the linker script start at
+                # upload.offset_address, not at the 0x08000000 alias
+                "--address", str(board_config.get("upload.offset_address", "0x00000000")),
+                "--fallback", "\"%s\"" % os.path.join("$BUILD_DIR", "${PROGNAME}${PROGSUFFIX}"),
+                "--", "$UPLOADER", "$UPLOADERFLAGS"]),
+        )
+        upload_target = target_bin
+    else:
+        openocd_args.extend(
+            [
+                "-c", "program {$SOURCE} verify reset",
+                "-c", "shutdown"
+            ]
+        )
+        env.Replace(
+            UPLOADER="openocd",
+            UPLOADERFLAGS=openocd_args,
+            UPLOADCMD="$UPLOADER $UPLOADERFLAGS",
+        )
     upload_actions = [env.VerboseAction("$UPLOADCMD", "Uploading $SOURCE")]
 
 # WCHISP
 elif upload_protocol == "isp":
+    if sram_code_mode is not None:
+        print("Warning: wchisp cannot program the SRAM / flash split. Make sure the "
+              "option bytes match board_build.ram_flash_split = %s (e.g. via WCHISPTool)" % ram_flash_split)
     env.Replace(
         UPLOADER="wchisp",
         UPLOADERFLAGS="",
@@ -169,6 +436,9 @@ elif upload_protocol == "minichlink":
         UPLOADERPOSTFLAGS="%s -b" % str(flash_start), # address, (re)boot from halt
         UPLOADCMD="$UPLOADER $UPLOADERFLAGS $SOURCE $UPLOADERPOSTFLAGS",
     )
+    if use_delta_upload:
+        env.Replace(UPLOADCMD=" ".join(get_delta_upload_cmd("minichlink") + [
+            "--address", str(flash_start), "--", "$UPLOADER"]))
     upload_target = target_bin
     upload_actions = [env.VerboseAction("$UPLOADCMD", "Uploading $SOURCE")]
 # custom upload tool
@@ -180,6 +450,33 @@ else:
 
 env.AddPlatformTarget("upload", upload_target, upload_actions, "Upload")
 
+#
+# Target: Upload to all attached devices in parallel (production)
+#
+
+upload_all_cmd = None
+if upload_protocol in debug_tools and upload_protocol != "minichlink":
+    # OpenOCD can't enumerate the probes, the serial numbers have to be given
+    upload_all_cmd = ["--tool", "openocd", "--", "openocd"] + [
+        '"%s"' % arg if " " in arg else arg for arg in openocd_base_args]
+elif upload_protocol == "isp":
+    upload_all_cmd = ["--tool", "wchisp", "--", "wchisp"]
+if upload_all_cmd is not None:
+    env.AddPlatformTarget(
+        "upload_all",
+        target_elf,
+        env.VerboseAction(" ".join([
+            "\"$PYTHONEXE\"",
+            "\"%s\"" % os.path.join(platform.get_dir(), "misc", "scripts", "upload_all.py"),
+            "--image", "\"$SOURCE\"",
+            "--devices", "\"%s\"" % board_config.get("build.upload_all_devices", ""),
+            "--jobs", str(board_config.get("build.upload_all_jobs", 0)),
+            "--log-dir", "\"%s\"" % os.path.join("$BUILD_DIR", "upload_all"),
+        ] + upload_all_cmd), "Uploading $SOURCE to all devices"),
+        "Upload All",
+        "Upload and verify the firmware on all attached devices in parallel",
+    )
+
 #
 # Target: Disable / Enable / Check Code Read Protection, Erase
 #
@@ -263,6 +560,16 @@ if access_via_openocd:
         ], "Erasing Flash"),
         "Erase Flash"
     )
+
+    if sram_code_mode is not None:
+        env.AddPlatformTarget(
+            "set_ram_flash_split", None, generate_openocd_action([
+                "-f", "\"%s\"" % os.path.join(
+                    platform.get_dir(), "misc", "openocd", "ch32v30x_option_bytes.tcl"),
+                "-c", "\"ch32v30x_set_sram_code_mode %d\"" % sram_code_mode,
+            ], "Setting SRAM / Flash split to %s" % ram_flash_split),
+            "Set SRAM / Flash Split"
+        )
 elif upload_protocol == "isp":
     env.AddPlatformTarget(
         "info", None, generate_wchisp_action([
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+# Runs the four throughput tests of the iperf example against iperf 2 on
+# this PC and prints what the board reported on its UART:
+#
+#   tcp sink     iperf -c <board>          board receives TCP
+#   tcp source   iperf -s                  board sends TCP ("tcp" command)
+#   udp sink     iperf -c <board> -u -b R  board receives UDP
+#   udp source   iperf -s -u               board sends UDP ("udp" command)
+#
+# For each test the Mbit/s of the board and of iperf, the TCP
+# retransmissions, the UDP loss and jitter and the CPU load of the board
+# are shown, with --json they are also written to a file.
+#
+#   iperf_bench.py --uart /dev/ttyUSB0 --board 192.168.1.50 [--time 10] [--rate 5M]
+#
+# Needs pyserial and iperf 2 (not iperf3, which uses another protocol).
+from dataclasses import dataclass, asdict
+from typing import List, Optional
+import argparse
+import json
+import re
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+TESTS = ("tcp_sink", "tcp_source", "udp_sink", "udp_source")
+
+# "[tcp source]   0.0- 10.0 sec   12207 KBytes  10.00 Mbits/sec retrans 3 cpu 41% wakeups 8123 total"
+REPORT = re.compile(r"^\[(tcp|udp) (sink|source)\]\s+([\d.]+)-\s*([\d.]+) sec\s+(\d+) KBytes\s+([\d.]+) Mbits/sec"
+                    r"(?: retrans (\d+))?(?: jitter ([\d.]+) ms lost (\d+)/(\d+) ooo \d+)?(?: sent \d+)?"
+                    r" cpu (\d+)% wakeups (\d+)( total)?$")
+IPERF_RATE = re.compile(r"([\d.]+) Mbits/sec")
+
+@dataclass
+class Result:
+    test: str
+    seconds: float = 0.0
+    mbps: Optional[float] = None        # board
+    iperf_mbps: Optional[float] = None  # iperf on this PC
+    retrans: Optional[int] = None
+    jitter_ms: Optional[float] = None
+    lost: Optional[int] = None
+    datagrams: Optional[int] = None
+    cpu: Optional[int] = None
+    wakeups: Optional[int] = None
+
+class Board:
+    """UART of the board, collects the report lines in a thread."""
+    def __init__(self, port: str, baudrate: int):
+        import serial
+        self.uart = serial.Serial(port, baudrate, timeout=0.2)
+        self.lines: List[str] = []
+        self.cond = threading.Condition()
+        threading.Thread(target=self._read, daemon=True).start()
+
+    def _read(self):
+        buf = b""
+        while True:
+            buf += self.uart.read(256)
+            while b"\n" in buf:
+                line, buf = buf.split(b"\n", 1)
+                text = line.decode("ascii", "replace").strip()
+                if text:
+                    with self.cond:
+                        self.lines.append(text)
+                        self.cond.notify_all()
+
+    def command(self, text: str):
+        self.uart.write((text + "\r\n").encode("ascii"))
+
+    def total(self, test: str, timeout: float) -> Optional[re.Match]:
+        """Waits for the total line of a test, returns None on timeout."""
+        name = test.replace("_", " ")
+        end = time.monotonic() + timeout
+        with self.cond:
+            while True:
+                while self.lines:
+                    line = self.lines.pop(0)
+                    print("  board: " + line)
+                    m = REPORT.match(line)
+                    if m and m.group(13) and "%s %s" % m.group(1, 2) == name:
+                        return m
+                left = end - time.monotonic()
+                if left <= 0:
+                    return None
+                self.cond.wait(left)
+
+    def flush(self):
+        with self.cond:
+            self.lines.clear()
+
+def local_ip(board: str) -> str:
+    """Address of this PC on the way to the board."""
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+        s.connect((board, 5001))
+        return s.getsockname()[0]
+
+def iperf_mbps(output: str) -> Optional[float]:
+    """Rate of the last line of iperf, the summary."""
+    rates = IPERF_RATE.findall(output)
+    return float(rates[-1]) if rates else None
+
+def run(board: Board, test: str, args) -> Result:
+    proto, role = test.split("_")
+    udp = ["-u"] if proto == "udp" else []
+    board.flush()
+    if role == "sink":
+        cmd = [args.iperf, "-c", args.board, "-p", str(args.iperf_port), "-t", str(args.time),
+               "-f", "m"] + udp + (["-b", args.rate] if udp else [])
+        out = subprocess.run(cmd, capture_output=True, text=True, timeout=args.time + 30).stdout
+        m = board.total(test, 5)
+    else:
+        cmd = [args.iperf, "-s", "-p", str(args.iperf_port), "-f", "m"] + udp
+        server = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+        try:
+            time.sleep(1)
+            board.command("%s %s %d %d%s" % (proto, args.host, args.iperf_port, args.time,
+                                              " " + args.rate if udp else ""))
+            m = board.total(test, args.time + 10)
+            time.sleep(1)
+        finally:
+            server.terminate()
+            out = server.communicate()[0]
+    print("  iperf: " + (out.strip().splitlines() or [""])[-1])
+
+    result = Result(test, iperf_mbps=iperf_mbps(out))
+    if m is None:
+        print("Error: no result from the board for %s" % test, file=sys.stderr)
+        return result
+    result.seconds = float(m.group(4)) - float(m.group(3))
+    result.mbps = float(m.group(6))
+    if m.group(7) is not None:
+        result.retrans = int(m.group(7))
+    if m.group(8) is not None:
+        result.jitter_ms = float(m.group(8))
+        result.lost = int(m.group(9))
+        result.datagrams = int(m.group(10))
+    result.cpu = int(m.group(11))
+    result.wakeups = int(m.group(12))
+    return result
+
+def table(results: List[Result]) -> str:
+    def opt(value, fmt):
+        return fmt % value if value is not None else "-"
+    out = ["%-11s %8s %8s %8s %10s %13s %5s" % ("test", "Mbit/s", "iperf", "retrans", "jitter ms", "lost", "cpu")]
+    for r in results:
+        lost = "%d/%d" % (r.lost, r.datagrams) if r.lost is not None else "-"
+        out.append("%-11s %8s %8s %8s %10s %13s %5s" % (
+            r.test, opt(r.mbps, "%.2f"), opt(r.iperf_mbps, "%.2f"), opt(r.retrans, "%d"),
+            opt(r.jitter_ms, "%.3f"), lost, opt(r.cpu, "%d%%")))
+    return "\n".join(out)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Throughput of the iperf example against iperf 2")
+    parser.add_argument("--uart", required=True, help="serial port of the board, e.g. /dev/ttyUSB0 or COM3")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("--board", required=True, help="IP address of the board")
+    parser.add_argument("--host", help="IP address of this PC, for the source tests")
+    parser.add_argument("--iperf", default="iperf", help="iperf 2 executable")
+    parser.add_argument("--iperf-port", type=int, default=5001)
+    parser.add_argument("--time", type=int, default=10, help="seconds per test")
+    parser.add_argument("--rate", default="5M", help="UDP rate, as iperf -b")
+    parser.add_argument("--tests", default=",".join(TESTS), help="comma separated, of " + ", ".join(TESTS))
+    parser.add_argument("--json", help="write the results to this file")
+    args = parser.parse_args()
+
+    tests = [t.strip() for t in args.tests.split(",") if t.strip()]
+    for t in tests:
+        if t not in TESTS:
+            parser.error("unknown test %s" % t)
+    if not args.host:
+        args.host = local_ip(args.board)
+    try:
+        board = Board(args.uart, args.baudrate)
+    except Exception as e:
+        print("Error: %s" % e, file=sys.stderr)
+        sys.exit(1)
+
+    results = []
+    for t in tests:
+        print("%s:" % t)
+        results.append(run(board, t, args))
+        time.sleep(1)
+    print()
+    print(table(results))
+    if args.json:
+        with open(args.json, "w") as fp:
+            json.dump([asdict(r) for r in results], fp, indent=2)
+    sys.exit(0 if all(r.mbps is not None for r in results) else 1)
@@ -0,0 +1,391 @@
+/*
+ * iperf2 compatible streams of the iperf example.
+ *
+ * The board is either end of an iperf2 test: it sinks what "iperf -c"
+ * sends to port 5001, or it sources a stream to "iperf -s" when started
+ * with a UART command. This file keeps the counters of the stream and
+ * speaks the iperf2 wire format, main.c moves the data with WCHNET.
+ *
+ * UDP datagrams start with a header of a sequence number and the send
+ * time (all big endian). The sink counts lost and reordered datagrams
+ * from the numbers and the RFC 1889 jitter from the send times. The
+ * client ends the test with a negative number, the sink answers it with
+ * the same header followed by the server report (server_hdr of iperf2),
+ * which the client prints as the server side result.
+ *
+ * TCP retransmissions are not counted by WCHNET, so the frames that are
+ * sent are passed to Iperf_TxFrame(): a data segment of the stream that
+ * starts below the highest sequence number sent so far is sent again.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "iperf.h"
+
+static const char *const iperf_names[] = { "", "tcp sink", "tcp source", "udp sink", "udp source" };
+
+static u32 iperf_get32(const u8 *p)
+{
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+static void iperf_put32(u8 *p, u32 v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+/*********************************************************************
+ * @fn      Iperf_Start
+ *
+ * @brief   Clear the counters and start a test.
+ *
+ * @param   s - stream
+ *          mode - IPERF_TCP_SINK .. IPERF_UDP_SOURCE
+ *          now - time in us
+ *
+ * @return  none
+ */
+void Iperf_Start(Iperf_Stream_t *s, u8 mode, u32 now)
+{
+    u8 socket = s->socket;
+    u16 port = s->port;
+
+    memset(s, 0, sizeof(*s));
+    s->mode = mode;
+    s->socket = socket;
+    s->port = port;
+    s->start = now;
+    s->last = now;
+    s->udp_id = -1;
+}
+
+/*********************************************************************
+ * @fn      Iperf_Pattern
+ *
+ * @brief   Fill a send buffer with the digits iperf2 sends.
+ *
+ * @param   buf - buffer
+ *          len - buffer length
+ *
+ * @return  none
+ */
+void Iperf_Pattern(u8 *buf, u32 len)
+{
+    u32 i;
+
+    for(i = 0; i < len; i++)
+        buf[i] = '0' + i % 10;
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpHead
+ *
+ * @brief   Write the header of a datagram.
+ *
+ * @param   buf - datagram, at least IPERF_UDP_HEAD_LEN bytes
+ *          id - sequence number, negative for the last one
+ *          now - send time in us
+ *
+ * @return  none
+ */
+void Iperf_UdpHead(u8 *buf, s32 id, u32 now)
+{
+    iperf_put32(buf, (u32)id);
+    iperf_put32(buf + 4, now / 1000000);
+    iperf_put32(buf + 8, now % 1000000);
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpRecv
+ *
+ * @brief   Count a datagram of a UDP sink.
+ *
+ * @param   s - stream
+ *          buf - datagram
+ *          len - datagram length
+ *          now - receive time in us
+ *
+ * @return  1 if it ends the test, the client waits for
+ *          Iperf_UdpReport() then, 0 otherwise
+ */
+u8 Iperf_UdpRecv(Iperf_Stream_t *s, const u8 *buf, u32 len, u32 now)
+{
+    s32 id, transit, d;
+
+    if(len < IPERF_UDP_HEAD_LEN)
+        return 0;
+    id = (s32)iperf_get32(buf);
+    if(id < 0)
+        return 1;
+
+    s->bytes += len;
+    transit = (s32)(now - (iperf_get32(buf + 4) * 1000000 + iperf_get32(buf + 8)));
+    if(s->datagrams)
+    {
+        d = transit - s->transit;                               //The clocks are not in sync, only the difference counts
+        if(d < 0)
+            d = -d;
+        s->jitter += d - ((s->jitter + 8) >> 4);                //J += (|D| - J) / 16, J kept * 16
+    }
+    s->transit = transit;
+    s->datagrams++;
+
+    if(id > s->udp_id)
+    {
+        s->lost += id - s->udp_id - 1;
+        s->udp_id = id;
+    }
+    else                                                        //Late, it was counted as lost
+    {
+        s->outorder++;
+        if(s->lost)
+            s->lost--;
+    }
+    return 0;
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpReport
+ *
+ * @brief   Build the answer to the last datagram of a UDP sink.
+ *
+ * @param   s - stream
+ *          fin - the last datagram, its header is sent back
+ *          buf - answer, IPERF_UDP_REPORT_LEN bytes
+ *          now - time in us
+ *
+ * @return  length of the answer
+ */
+u32 Iperf_UdpReport(const Iperf_Stream_t *s, const u8 *fin, u8 *buf, u32 now)
+{
+    u8 *hdr = buf + IPERF_UDP_HEAD_LEN;
+    u32 jitter = s->jitter >> 4;
+
+    memcpy(buf, fin, IPERF_UDP_HEAD_LEN);
+    iperf_put32(hdr, IPERF_HEADER_VERSION1);                    //flags
+    iperf_put32(hdr + 4, (u32)(s->bytes >> 32));                //total_len1
+    iperf_put32(hdr + 8, (u32)s->bytes);                        //total_len2
+    iperf_put32(hdr + 12, (now - s->start) / 1000000);          //stop_sec
+    iperf_put32(hdr + 16, (now - s->start) % 1000000);          //stop_usec
+    iperf_put32(hdr + 20, s->lost);                             //error_cnt
+    iperf_put32(hdr + 24, s->outorder);                         //outorder_cnt
+    iperf_put32(hdr + 28, (u32)(s->udp_id + 1));                //datagrams
+    iperf_put32(hdr + 32, jitter / 1000000);                    //jitter1
+    iperf_put32(hdr + 36, jitter % 1000000);                    //jitter2
+    return IPERF_UDP_REPORT_LEN;
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpServerReport
+ *
+ * @brief   Take lost, reordered datagrams and jitter of a UDP source
+ *          from the server report "iperf -s -u" sent back.
+ *
+ * @param   s - stream
+ *          buf - datagram
+ *          len - datagram length
+ *
+ * @return  1 if it was a server report, 0 otherwise
+ */
+u8 Iperf_UdpServerReport(Iperf_Stream_t *s, const u8 *buf, u32 len)
+{
+    const u8 *hdr = buf + IPERF_UDP_HEAD_LEN;
+
+    if(len < IPERF_UDP_REPORT_LEN || !(iperf_get32(hdr) & IPERF_HEADER_VERSION1))
+        return 0;
+    s->lost = iperf_get32(hdr + 20);
+    s->outorder = iperf_get32(hdr + 24);
+    s->udp_id = (s32)iperf_get32(hdr + 28) - 1;
+    s->jitter = (iperf_get32(hdr + 32) * 1000000 + iperf_get32(hdr + 36)) << 4;
+    return 1;
+}
+
+/*********************************************************************
+ * @fn      Iperf_TxFrame
+ *
+ * @brief   Count the segments of a TCP source and the ones sent again,
+ *          called with every Ethernet frame that is sent.
+ *
+ * @param   s - stream
+ *          frame - Ethernet frame
+ *          len - frame length
+ *
+ * @return  none
+ */
+void Iperf_TxFrame(Iperf_Stream_t *s, const u8 *frame, u32 len)
+{
+    const u8 *ip = frame + 14, *tcp;
+    u32 ihl, payload, seq;
+
+    if(s->mode != IPERF_TCP_SOURCE || len < 14 + 20 + 20)
+        return;
+    if(frame[12] != 0x08 || frame[13] != 0x00 || ip[9] != 6)  //IPv4, TCP
+        return;
+    ihl = (ip[0] & 0x0F) * 4;
+    tcp = ip + ihl;
+    if(14 + ihl + 20 > len || ((tcp[0] << 8) | tcp[1]) != s->port)
+        return;
+    payload = ((ip[2] << 8) | ip[3]) - ihl - (tcp[12] >> 4) * 4;
+    if((s32)payload <= 0)                                       //ACK only
+        return;
+
+    seq = iperf_get32(tcp + 4);
+    if(s->datagrams && (s32)(seq - s->tcp_next) < 0)
+        s->retrans++;
+    if(!s->datagrams || (s32)(seq + payload - s->tcp_next) > 0)
+        s->tcp_next = seq + payload;
+    s->datagrams++;
+}
+
+/*********************************************************************
+ * @fn      Iperf_Format
+ *
+ * @brief   Report line in the style of iperf2, for the time since the
+ *          last report or for the whole test.
+ *
+ * @param   s - stream
+ *          buf - line
+ *          size - size of buf
+ *          now - time in us
+ *          final - 1 for the whole test
+ *
+ * @return  length of the line
+ */
+int Iperf_Format(Iperf_Stream_t *s, char *buf, u32 size, u32 now, u8 final)
+{
+    u32 from = final ? s->start : s->last, us = now - from;
+    u64 bytes = final ? s->bytes : s->bytes - s->last_bytes;
+    u32 rate = us ? (u32)(bytes * 8 * 100 / us) : 0;            //Mbit/s * 100
+    u32 jitter = s->jitter >> 4;
+    int n;
+
+    n = snprintf(buf, size, "[%s] %3u.%u-%3u.%u sec %7u KBytes %3u.%02u Mbits/sec",
+                 iperf_names[s->mode],
+                 (unsigned)((from - s->start) / 1000000), (unsigned)((from - s->start) / 100000 % 10),
+                 (unsigned)((now - s->start) / 1000000), (unsigned)((now - s->start) / 100000 % 10),
+                 (unsigned)(bytes / 1024), (unsigned)(rate / 100), (unsigned)(rate % 100));
+    if(n < 0 || (u32)n >= size)
+        return n < 0 ? 0 : (int)size - 1;
+
+    if(s->mode == IPERF_TCP_SOURCE)
+        n += snprintf(buf + n, size - n, " retrans %u", (unsigned)s->retrans);
+    else if(s->mode == IPERF_UDP_SINK || (s->mode == IPERF_UDP_SOURCE && final && s->udp_id >= 0))
+        n += snprintf(buf + n, size - n, " jitter %u.%03u ms lost %u/%u ooo %u",
+                      (unsigned)(jitter / 1000), (unsigned)(jitter % 1000),
+                      (unsigned)s->lost, (unsigned)(s->udp_id + 1), (unsigned)s->outorder);
+    else if(s->mode == IPERF_UDP_SOURCE)
+        n += snprintf(buf + n, size - n, " sent %u", (unsigned)s->datagrams);
+    if((u32)n >= size)
+        n = size - 1;
+
+    if(!final)
+    {
+        s->last = now;
+        s->last_bytes = s->bytes;
+    }
+    return n;
+}
+
+static const char *iperf_skip(const char *p)
+{
+    while(*p == ' ' || *p == '\t')
+        p++;
+    return p;
+}
+
+static const char *iperf_uint(const char *p, u32 *v)
+{
+    const char *start = p;
+
+    *v = 0;
+    while(*p >= '0' && *p <= '9' && p - start < 9)
+        *v = *v * 10 + (*p++ - '0');
+    return p == start || (*p >= '0' && *p <= '9') ? NULL : p;
+}
+
+/*********************************************************************
+ * @fn      Iperf_ParseCmd
+ *
+ * @brief   Parse a UART command:
+ *          tcp <ip> [port] [seconds]
+ *          udp <ip> [port] [seconds] [rate[K|M]]
+ *          stop
+ *          The rate is in bit/s like "iperf -b".
+ *
+ * @param   line - command, without the line end
+ *          cmd - parsed command, defaults for what is left out
+ *
+ * @return  IPERF_TCP_SOURCE, IPERF_UDP_SOURCE or IPERF_STOP,
+ *          IPERF_IDLE if it is not a command
+ */
+u8 Iperf_ParseCmd(const char *line, Iperf_Cmd_t *cmd)
+{
+    const char *p = iperf_skip(line);
+    u32 v;
+    u8 i;
+
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->port = IPERF_PORT;
+    cmd->time = IPERF_TIME;
+    cmd->rate = IPERF_RATE;
+
+    if(!strncmp(p, "stop", 4) && !*iperf_skip(p + 4))
+        return cmd->mode = IPERF_STOP;
+    if(!strncmp(p, "tcp ", 4))
+        cmd->mode = IPERF_TCP_SOURCE;
+    else if(!strncmp(p, "udp ", 4))
+        cmd->mode = IPERF_UDP_SOURCE;
+    else
+        return IPERF_IDLE;
+
+    p = iperf_skip(p + 4);
+    for(i = 0; i < 4; i++)
+    {
+        if(i && *p++ != '.')
+            return cmd->mode = IPERF_IDLE;
+        p = iperf_uint(p, &v);
+        if(!p || v > 255)
+            return cmd->mode = IPERF_IDLE;
+        cmd->ip[i] = v;
+    }
+
+    p = iperf_skip(p);
+    if(*p)
+    {
+        p = iperf_uint(p, &v);
+        if(!p || v == 0 || v > 0xFFFF)
+            return cmd->mode = IPERF_IDLE;
+        cmd->port = v;
+        p = iperf_skip(p);
+    }
+    if(*p)
+    {
+        p = iperf_uint(p, &v);
+        if(!p || v == 0 || v > 3600)
+            return cmd->mode = IPERF_IDLE;
+        cmd->time = v;
+        p = iperf_skip(p);
+    }
+    if(*p && cmd->mode == IPERF_UDP_SOURCE)
+    {
+        p = iperf_uint(p, &v);
+        if(!p)
+            return cmd->mode = IPERF_IDLE;
+        if(*p == 'M' || *p == 'm')
+        {
+            v *= 1000;
+            p++;
+        }
+        else if(*p == 'K' || *p == 'k')
+            p++;
+        else
+            v /= 1000;                                          //bit/s
+        if(v == 0 || v > 1000000)
+            return cmd->mode = IPERF_IDLE;
+        cmd->rate = v;
+        p = iperf_skip(p);
+    }
+    return *p ? (cmd->mode = IPERF_IDLE) : cmd->mode;
+}
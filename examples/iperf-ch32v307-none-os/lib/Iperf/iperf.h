@@ -0,0 +1,72 @@
+/*
+ * iperf2 compatible streams of the iperf example: counters, the UDP
+ * datagram header and server report, the report lines and the UART
+ * commands. No WCHNET calls, so it also runs in the host tests.
+ */
+#ifndef __IPERF_H__
+#define __IPERF_H__
+#include "debug.h"
+
+#define IPERF_PORT                5001                   /* iperf2 default port */
+#define IPERF_TIME                10                     /* iperf2 default test length, seconds */
+#define IPERF_RATE                1000                   /* iperf2 default UDP rate, kbit/s */
+#define IPERF_UDP_LEN             1470                   /* iperf2 default datagram length */
+#define IPERF_UDP_HEAD_LEN        12                     /* id, tv_sec, tv_usec */
+#define IPERF_UDP_REPORT_LEN      (IPERF_UDP_HEAD_LEN + 40) /* datagram header and server_hdr */
+#define IPERF_HEADER_VERSION1     0x80000000
+
+/*Stream modes*/
+#define IPERF_IDLE                0
+#define IPERF_TCP_SINK            1                      /* iperf -c <board> */
+#define IPERF_TCP_SOURCE          2                      /* iperf -s */
+#define IPERF_UDP_SINK            3                      /* iperf -c <board> -u */
+#define IPERF_UDP_SOURCE          4                      /* iperf -s -u */
+#define IPERF_STOP                5                      /* UART command "stop" */
+
+typedef struct Iperf_Stream                     //One test, times in microseconds
+{
+    u8  mode;
+    u8  socket;
+    u16 port;                                   //Local port of a source, to find its frames
+    u32 start;
+    u32 last;                                   //Time of the last report
+    u64 bytes;
+    u64 last_bytes;                             //bytes at the last report
+    u32 retrans;                                //TCP segments sent again
+    u32 tcp_next;                               //Sequence number after the highest segment sent
+    u32 datagrams;                              //UDP datagrams received or sent, TCP segments sent
+    s32 udp_id;                                 //Highest datagram id received
+    u32 lost;
+    u32 outorder;
+    u32 jitter;                                 //RFC 1889 interarrival jitter, us * 16
+    s32 transit;                                //Transit time of the last datagram
+} Iperf_Stream_t;
+
+typedef struct Iperf_Cmd                        //Source test started over the UART
+{
+    u8  mode;
+    u8  ip[4];
+    u16 port;
+    u16 time;                                   //seconds
+    u32 rate;                                   //UDP, kbit/s
+} Iperf_Cmd_t;
+
+extern void Iperf_Start(Iperf_Stream_t *s, u8 mode, u32 now);
+
+extern void Iperf_Pattern(u8 *buf, u32 len);
+
+extern void Iperf_UdpHead(u8 *buf, s32 id, u32 now);
+
+extern u8 Iperf_UdpRecv(Iperf_Stream_t *s, const u8 *buf, u32 len, u32 now);
+
+extern u32 Iperf_UdpReport(const Iperf_Stream_t *s, const u8 *fin, u8 *buf, u32 now);
+
+extern u8 Iperf_UdpServerReport(Iperf_Stream_t *s, const u8 *buf, u32 len);
+
+extern void Iperf_TxFrame(Iperf_Stream_t *s, const u8 *frame, u32 len);
+
+extern int Iperf_Format(Iperf_Stream_t *s, char *buf, u32 size, u32 now, u8 final);
+
+extern u8 Iperf_ParseCmd(const char *line, Iperf_Cmd_t *cmd);
+
+#endif
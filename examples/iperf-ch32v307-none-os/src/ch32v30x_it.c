@@ -0,0 +1,61 @@
+/********************************** (C) COPYRIGHT *******************************
+* File Name          : ch32v30x_it.c
+* Author             : WCH
+* Version            : V1.0.0
+* Date               : 2022/01/18
+* Description        : Main Interrupt Service Routines.
+*********************************************************************************
+* Copyright (c) 2021 Nanjing Qinheng Microelectronics Co., Ltd.
+* Attention: This software (modified or not) and binary are used for 
+* microcontroller manufactured by Nanjing Qinheng Microelectronics.
+*******************************************************************************/
+#include "eth_driver.h"
+#include "ch32v30x_it.h"
+
+/* The ETH, TIM2 and PHY link (EXTI9_5) handlers are in lib/NetLib/net_idle.c */
+void NMI_Handler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+void HardFault_Handler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+void USART1_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+/*********************************************************************
+ * @fn      NMI_Handler
+ *
+ * @brief   This function handles NMI exception.
+ *
+ * @return  none
+ */
+void NMI_Handler(void)
+{
+}
+
+/*********************************************************************
+ * @fn      HardFault_Handler
+ *
+ * @brief   This function handles Hard Fault exception.
+ *
+ * @return  none
+ */
+void HardFault_Handler(void)
+{
+    printf("HardFault_Handler\r\n");
+
+    printf("mepc  :%08x\r\n", __get_MEPC());
+    printf("mcause:%08x\r\n", __get_MCAUSE());
+    printf("mtval :%08x\r\n", __get_MTVAL());
+    while(1);
+}
+
+/*********************************************************************
+ * @fn      USART1_IRQHandler
+ *
+ * @brief   This function handles USART1 exception.
+ *
+ * @return  none
+ */
+void USART1_IRQHandler(void)
+{
+    if(USART_GetITStatus(USART1, USART_IT_RXNE) != RESET)
+    {
+        UART_RxByte(USART_ReceiveData(USART1));    /* Reading the data clears the flag */
+        NetEventPending = 1;
+    }
+}
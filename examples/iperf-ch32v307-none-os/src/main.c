@@ -0,0 +1,669 @@
+/********************************** (C) COPYRIGHT *******************************
+ * File Name          : main.c
+ * Author             : WCH
+ * Version            : V1.0.0
+ * Date               : 2022/01/18
+ * Description        : Main program body.
+*********************************************************************************
+* Copyright (c) 2021 Nanjing Qinheng Microelectronics Co., Ltd.
+* Attention: This software (modified or not) and binary are used for
+* microcontroller manufactured by Nanjing Qinheng Microelectronics.
+*******************************************************************************/
+/*
+ *@Note
+iperf example, this program measures the throughput of WCHNET and the Ethernet
+driver against iperf 2 on a PC. The board gets its address by DHCP and then
+- sinks "iperf -c <board>" (TCP) and "iperf -c <board> -u" (UDP) on port 5001,
+- sources a stream to "iperf -s" / "iperf -s -u" when started over the UART:
+  tcp <ip> [port] [seconds]
+  udp <ip> [port] [seconds] [rate[K|M]]
+  stop
+Every second and at the end of a test a line with the throughput, the TCP
+retransmissions or UDP loss and jitter and the CPU load is printed on the UART,
+iperf_bench.py runs all four tests and collects these lines.
+ */
+#include "string.h"
+#include "eth_driver.h"
+#include "net_idle.h"
+#include "ch32v30x_it.h"
+#include "iperf.h"
+
+u8 MACAddr[6];                                                  //MAC address
+u8 IPAddr[4];                                                   //IP address, by DHCP
+u8 GWIPAddr[4];                                                 //Gateway IP address
+u8 IPMask[4];                                                   //subnet mask
+
+u8 SocketIdForListen, SocketIdForUdp;
+u8 SocketRecvBuf[WCHNET_MAX_SOCKET_NUM][RECE_BUF_LEN];          //socket receive buffer
+
+/*What a source sends, one TCP window. WCHNET does not copy it
+ * (CFG0_TCP_SEND_COPY), so it must not change while a TCP test runs*/
+__attribute__((__aligned__(4))) u8 TxPattern[RECE_BUF_LEN];
+u8 UdpDatagram[IPERF_UDP_LEN];
+u8 UdpReport[IPERF_UDP_REPORT_LEN];                             //Answer to the last datagram of a UDP sink
+u32 UdpReportLen;
+
+Iperf_Stream_t Stream;
+Iperf_Cmd_t Cmd;                                                //Source test, mode IPERF_IDLE if none
+u16 SourcePort = 50000;                                         //Local port of the next source test
+u32 StreamEnd;                                                  //End of a source test
+u32 UdpNext;                                                    //Time the next datagram is due
+u32 UdpPeriod;                                                  //Time between datagrams
+u8  UdpFin;                                                     //Last datagrams sent, IPERF_FIN_DONE when answered
+u32 UdpLastRx;                                                  //Last datagram of a UDP sink
+u32 StartIdleUs, StartWakeups, ReportIdleUs, ReportWakeups;     //NetLoad at the start and the last report
+
+#define IPERF_FIN_TRIES     10                                  //As iperf2, the last datagram is sent again
+#define IPERF_FIN_WAIT      250000                              //until the server answers
+#define IPERF_FIN_DONE      0xFF
+#define IPERF_UDP_TIMEOUT   2000000                             //UDP sink without datagrams, the last one was lost
+#define IPERF_REPORT_PERIOD 1000000
+
+/*UART command line, filled by USART1_IRQHandler*/
+char UartLine[64];
+u8 UartLen;
+u8 volatile UartReady;
+
+uint32_t __real_ETH_TxPktChainMode(uint16_t len, uint32_t *pBuff);
+
+/*********************************************************************
+ * @fn      mStopIfError
+ *
+ * @brief   check if error.
+ *
+ * @param   iError - error constants.
+ *
+ * @return  none
+ */
+void mStopIfError(u8 iError)
+{
+    if (iError == WCHNET_ERR_SUCCESS)
+        return;
+    printf("Error: %02X\r\n", (u16) iError);
+}
+
+/*********************************************************************
+ * @fn      UART_RxInit
+ *
+ * @brief   Enable the receiver of USART1 (PA10) for the commands,
+ *          USART_Printf_Init only enables the transmitter.
+ *
+ * @return  none
+ */
+void UART_RxInit(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure = { 0 };
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_10;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN_FLOATING;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    USART1->CTLR1 |= USART_Mode_Rx;
+    USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);
+    NVIC_EnableIRQ(USART1_IRQn);
+}
+
+/*********************************************************************
+ * @fn      UART_RxByte
+ *
+ * @brief   Collect a command line, called by USART1_IRQHandler.
+ *          Characters are dropped until the main loop took the line.
+ *
+ * @param   ch - received character
+ *
+ * @return  none
+ */
+void UART_RxByte(u8 ch)
+{
+    if(UartReady)
+        return;
+    if(ch == '\r' || ch == '\n')
+    {
+        if(UartLen)
+        {
+            UartLine[UartLen] = 0;
+            UartReady = 1;
+        }
+    }
+    else if(UartLen < sizeof(UartLine) - 1)
+        UartLine[UartLen++] = ch;
+}
+
+/*********************************************************************
+ * @fn      __wrap_ETH_TxPktChainMode
+ *
+ * @brief   Send function of WCHNET, linked in its place with
+ *          -Wl,--wrap=ETH_TxPktChainMode. Shows the frames that were
+ *          queued to Iperf_TxFrame, which counts the retransmissions.
+ *
+ * @param   len     Send data length
+ *          pBuff   send buffer pointer
+ *
+ * @return  Send status.
+ */
+uint32_t __wrap_ETH_TxPktChainMode(uint16_t len, uint32_t *pBuff)
+{
+    uint32_t ret = __real_ETH_TxPktChainMode(len, pBuff);
+
+    if(ret == ETH_SUCCESS)                                      //Not when WCHNET has to retry it
+        Iperf_TxFrame(&Stream, (const u8 *)pBuff, len);
+    return ret;
+}
+
+/*********************************************************************
+ * @fn      Iperf_Report
+ *
+ * @brief   Print a report line with the CPU load, for the time since
+ *          the last report or for the whole test.
+ *
+ * @param   now - time in us
+ *          final - 1 for the whole test
+ *
+ * @return  none
+ */
+void Iperf_Report(u32 now, u8 final)
+{
+    char line[128];
+    u32 us = now - (final ? Stream.start : Stream.last);
+    u32 idle_us = NetLoad.idle_us - (final ? StartIdleUs : ReportIdleUs);
+    u32 wakeups = NetLoad.wakeups - (final ? StartWakeups : ReportWakeups);
+    u32 cpu = 0;
+
+    if(us)
+        cpu = idle_us < us ? 100 - (u32)((u64)idle_us * 100 / us) : 0;
+    Iperf_Format(&Stream, line, sizeof(line), now, final);
+    printf("%s cpu %d%% wakeups %d%s\r\n", line, cpu, wakeups, final ? " total" : "");
+    ReportIdleUs = NetLoad.idle_us;
+    ReportWakeups = NetLoad.wakeups;
+}
+
+/*********************************************************************
+ * @fn      Iperf_Begin
+ *
+ * @brief   Start a test on a socket.
+ *
+ * @param   mode - IPERF_TCP_SINK .. IPERF_UDP_SOURCE
+ *          socketid - socket id
+ *          now - time in us
+ *
+ * @return  none
+ */
+void Iperf_Begin(u8 mode, u8 socketid, u32 now)
+{
+    Stream.socket = socketid;
+    Iperf_Start(&Stream, mode, now);
+    StartIdleUs = ReportIdleUs = NetLoad.idle_us;
+    StartWakeups = ReportWakeups = NetLoad.wakeups;
+    UdpReportLen = 0;
+    UdpLastRx = now;
+}
+
+/*********************************************************************
+ * @fn      Iperf_End
+ *
+ * @brief   Print the total of the test and close a source socket.
+ *
+ * @param   now - time in us
+ *
+ * @return  none
+ */
+void Iperf_End(u32 now)
+{
+    if(Stream.mode != IPERF_IDLE)
+        Iperf_Report(now, 1);
+    if(Cmd.mode != IPERF_IDLE)
+        WCHNET_SocketClose(Stream.socket, TCP_CLOSE_NORMAL);
+    Stream.mode = IPERF_IDLE;
+    Cmd.mode = IPERF_IDLE;
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpSinkRecv
+ *
+ * @brief   Receive callback of the UDP socket on port 5001.
+ *
+ * @param   socinf - socket information
+ *          ipaddr - remote IP, first byte lowest
+ *          port - remote port
+ *          buf - datagram
+ *          len - datagram length
+ *
+ * @return  none
+ */
+void Iperf_UdpSinkRecv(struct _SOCK_INF *socinf, u32 ipaddr, u16 port, u8 *buf, u32 len)
+{
+    u32 now = Net_Micros();
+    u8 ip[4], i;
+
+    if(Stream.mode == IPERF_IDLE && Cmd.mode == IPERF_IDLE &&
+       len >= IPERF_UDP_HEAD_LEN && !(buf[0] & 0x80))
+    {
+        Iperf_Begin(IPERF_UDP_SINK, socinf->SockIndex, now);
+    }
+    if(Stream.mode == IPERF_UDP_SINK && Stream.socket == socinf->SockIndex)
+    {
+        UdpLastRx = now;
+        if(!Iperf_UdpRecv(&Stream, buf, len, now))
+            return;
+        UdpReportLen = Iperf_UdpReport(&Stream, buf, UdpReport, now);
+        Iperf_End(now);
+    }
+    /*The client sends the last datagram again until it gets the report*/
+    if(UdpReportLen && len >= IPERF_UDP_HEAD_LEN && (buf[0] & 0x80))
+    {
+        for(i = 0; i < 4; i++)
+        {
+            ip[i] = ipaddr & 0xff;
+            ipaddr = ipaddr >> 8;
+        }
+        len = UdpReportLen;
+        WCHNET_SocketUdpSendTo(socinf->SockIndex, UdpReport, &len, ip, port);
+    }
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpSourceRecv
+ *
+ * @brief   Receive callback of a UDP source, takes the server report.
+ *
+ * @param   socinf - socket information
+ *          ipaddr - remote IP
+ *          port - remote port
+ *          buf - datagram
+ *          len - datagram length
+ *
+ * @return  none
+ */
+void Iperf_UdpSourceRecv(struct _SOCK_INF *socinf, u32 ipaddr, u16 port, u8 *buf, u32 len)
+{
+    if(Stream.mode == IPERF_UDP_SOURCE && UdpFin && Iperf_UdpServerReport(&Stream, buf, len))
+        UdpFin = IPERF_FIN_DONE;                                //The main loop closes the socket
+}
+
+/*********************************************************************
+ * @fn      Iperf_Command
+ *
+ * @brief   Start or stop a source test from a UART command.
+ *
+ * @param   line - command
+ *
+ * @return  none
+ */
+void Iperf_Command(const char *line)
+{
+    Iperf_Cmd_t cmd;
+    SOCK_INF TmpSocketInf;
+    u8 mode = Iperf_ParseCmd(line, &cmd), socketid, i;
+
+    if(mode == IPERF_STOP)
+    {
+        if(Stream.mode == IPERF_TCP_SINK)
+            WCHNET_SocketClose(Stream.socket, TCP_CLOSE_NORMAL);
+        Iperf_End(Net_Micros());
+        return;
+    }
+    if(mode == IPERF_IDLE)
+    {
+        printf("tcp <ip> [port] [seconds] | udp <ip> [port] [seconds] [rate[K|M]] | stop\r\n");
+        return;
+    }
+    if(Stream.mode != IPERF_IDLE || Cmd.mode != IPERF_IDLE)
+    {
+        printf("busy\r\n");
+        return;
+    }
+
+    memset((void *) &TmpSocketInf, 0, sizeof(SOCK_INF));
+    memcpy((void *) TmpSocketInf.IPAddr, cmd.ip, 4);
+    TmpSocketInf.DesPort = cmd.port;
+    TmpSocketInf.SourPort = SourcePort;
+    SourcePort = SourcePort < 59999 ? SourcePort + 1 : 50000;
+    if(mode == IPERF_TCP_SOURCE)
+    {
+        TmpSocketInf.ProtoType = PROTO_TYPE_TCP;
+        TmpSocketInf.RecvBufLen = RECE_BUF_LEN;
+    }
+    else
+    {
+        TmpSocketInf.ProtoType = PROTO_TYPE_UDP;
+        TmpSocketInf.AppCallBack = Iperf_UdpSourceRecv;
+    }
+    i = WCHNET_SocketCreat(&socketid, &TmpSocketInf);
+    mStopIfError(i);
+    if(i != WCHNET_ERR_SUCCESS)
+        return;
+    WCHNET_ModifyRecvBuf(socketid, (u32)SocketRecvBuf[socketid], RECE_BUF_LEN);
+
+    Cmd = cmd;
+    Stream.socket = socketid;
+    Stream.port = TmpSocketInf.SourPort;
+    if(mode == IPERF_TCP_SOURCE)
+    {
+        i = WCHNET_SocketConnect(socketid);                     //The test starts with SINT_STAT_CONNECT
+        mStopIfError(i);
+        if(i != WCHNET_ERR_SUCCESS)
+            Iperf_End(Net_Micros());
+    }
+    else
+    {
+        Iperf_Begin(IPERF_UDP_SOURCE, socketid, Net_Micros());
+        StreamEnd = Stream.start + cmd.time * 1000000;
+        UdpPeriod = IPERF_UDP_LEN * 8 * 1000 / cmd.rate;
+        UdpNext = Stream.start;
+        UdpFin = 0;
+    }
+}
+
+/*********************************************************************
+ * @fn      Iperf_UdpSend
+ *
+ * @brief   Send the datagrams of a UDP source that are due, then the
+ *          last one until the server answers.
+ *
+ * @param   now - time in us
+ *
+ * @return  1 while datagrams are sent, the main loop must not sleep
+ */
+u8 Iperf_UdpSend(u32 now)
+{
+    u32 len;
+
+    if(UdpFin == IPERF_FIN_DONE)
+    {
+        Iperf_End(now);
+        return 0;
+    }
+    if((s32)(now - StreamEnd) < 0)
+    {
+        while((s32)(now - UdpNext) >= 0)
+        {
+            Iperf_UdpHead(UdpDatagram, Stream.datagrams, now);
+            len = IPERF_UDP_LEN;
+            if(WCHNET_SocketSend(Stream.socket, UdpDatagram, &len) != WCHNET_ERR_SUCCESS || len == 0)
+                break;                                          //Again in the next loop
+            Stream.bytes += len;
+            Stream.datagrams++;
+            UdpNext += UdpPeriod;
+        }
+        return 1;
+    }
+    if(UdpFin && now - UdpNext < IPERF_FIN_WAIT)
+        return 0;
+    if(UdpFin == IPERF_FIN_TRIES)
+    {
+        printf("no server report\r\n");
+        Iperf_End(now);
+        return 0;
+    }
+    Iperf_UdpHead(UdpDatagram, -(s32)Stream.datagrams, now);
+    len = IPERF_UDP_HEAD_LEN;
+    WCHNET_SocketSend(Stream.socket, UdpDatagram, &len);
+    UdpFin++;
+    UdpNext = now;
+    return 0;
+}
+
+/*********************************************************************
+ * @fn      Iperf_Task
+ *
+ * @brief   Send the data of a source test, print the reports and end
+ *          the tests that are over.
+ *
+ * @return  1 if the main loop must not sleep
+ */
+u8 Iperf_Task(void)
+{
+    u32 now = Net_Micros(), len;
+    u8 busy = 0;
+
+    if(Stream.mode == IPERF_TCP_SOURCE)
+    {
+        if((s32)(now - StreamEnd) >= 0)
+        {
+            Iperf_End(now);
+            return 0;
+        }
+        len = sizeof(TxPattern);
+        if(WCHNET_SocketSend(Stream.socket, TxPattern, &len) == WCHNET_ERR_SUCCESS && len)
+        {
+            Stream.bytes += len;
+            busy = 1;                                           //Let WCHNET send it, the ACKs wake up the loop otherwise
+        }
+    }
+    else if(Stream.mode == IPERF_UDP_SOURCE)
+        busy = Iperf_UdpSend(now);
+    else if(Stream.mode == IPERF_UDP_SINK && now - UdpLastRx >= IPERF_UDP_TIMEOUT)
+    {
+        printf("no end of test datagram\r\n");
+        Iperf_End(now);
+    }
+
+    if(Stream.mode != IPERF_IDLE && now - Stream.last >= IPERF_REPORT_PERIOD)
+        Iperf_Report(now, 0);
+    return busy;
+}
+
+/*********************************************************************
+ * @fn      WCHNET_CreateTcpSocketListen
+ *
+ * @brief   Create TCP Socket for Listening
+ *
+ * @return  none
+ */
+void WCHNET_CreateTcpSocketListen(void)
+{
+    u8 i;
+    SOCK_INF TmpSocketInf;
+
+    memset((void *) &TmpSocketInf, 0, sizeof(SOCK_INF));
+    TmpSocketInf.SourPort = IPERF_PORT;
+    TmpSocketInf.ProtoType = PROTO_TYPE_TCP;
+    i = WCHNET_SocketCreat(&SocketIdForListen, &TmpSocketInf);
+    printf("SocketIdForListen %d\r\n", SocketIdForListen);
+    mStopIfError(i);
+    i = WCHNET_SocketListen(SocketIdForListen);
+    mStopIfError(i);
+}
+
+/*********************************************************************
+ * @fn      WCHNET_CreateUdpSocket
+ *
+ * @brief   Create the UDP Socket of the UDP sink, datagrams from any
+ *          address go to Iperf_UdpSinkRecv
+ *
+ * @return  none
+ */
+void WCHNET_CreateUdpSocket(void)
+{
+    u8 i;
+    SOCK_INF TmpSocketInf;
+
+    memset((void *) &TmpSocketInf, 0, sizeof(SOCK_INF));
+    memset((void *) TmpSocketInf.IPAddr, 0xff, 4);
+    TmpSocketInf.SourPort = IPERF_PORT;
+    TmpSocketInf.ProtoType = PROTO_TYPE_UDP;
+    TmpSocketInf.AppCallBack = Iperf_UdpSinkRecv;
+    i = WCHNET_SocketCreat(&SocketIdForUdp, &TmpSocketInf);
+    printf("SocketIdForUdp %d\r\n", SocketIdForUdp);
+    mStopIfError(i);
+    WCHNET_ModifyRecvBuf(SocketIdForUdp, (u32)SocketRecvBuf[SocketIdForUdp], RECE_BUF_LEN);
+}
+
+/*********************************************************************
+ * @fn      WCHNET_HandleSockInt
+ *
+ * @brief   Socket Interrupt Handle
+ *
+ * @param   socketid - socket id.
+ *          intstat - interrupt status
+ *
+ * @return  none
+ */
+void WCHNET_HandleSockInt(u8 socketid, u8 intstat)
+{
+    u32 len;
+
+    if (intstat & SINT_STAT_RECV)                                   //receive data
+    {
+        len = WCHNET_SocketRecvLen(socketid, NULL);
+        WCHNET_SocketRecv(socketid, NULL, &len);                    //Only counted, not copied
+        if (Stream.mode == IPERF_TCP_SINK && Stream.socket == socketid)
+            Stream.bytes += len;
+    }
+    if (intstat & SINT_STAT_CONNECT)                                //connect successfully
+    {
+        WCHNET_ModifyRecvBuf(socketid, (u32)SocketRecvBuf[socketid], RECE_BUF_LEN);
+        if (Cmd.mode == IPERF_TCP_SOURCE && Stream.socket == socketid)
+        {
+            Iperf_Begin(IPERF_TCP_SOURCE, socketid, Net_Micros());
+            StreamEnd = Stream.start + Cmd.time * 1000000;
+        }
+        else if (Stream.mode == IPERF_IDLE && Cmd.mode == IPERF_IDLE)
+            Iperf_Begin(IPERF_TCP_SINK, socketid, Net_Micros());
+        else                                                        //One test at a time
+            WCHNET_SocketClose(socketid, TCP_CLOSE_ABANDON);
+        printf("TCP Connect Success\r\n");
+    }
+    if (intstat & (SINT_STAT_DISCONNECT | SINT_STAT_TIM_OUT))       //disconnect or timeout
+    {
+        if (Stream.socket == socketid && (Stream.mode == IPERF_TCP_SINK ||
+            Stream.mode == IPERF_TCP_SOURCE || Cmd.mode == IPERF_TCP_SOURCE))
+        {
+            Cmd.mode = IPERF_IDLE;                                  //Closed already
+            Iperf_End(Net_Micros());
+        }
+        printf(intstat & SINT_STAT_TIM_OUT ? "TCP Timeout\r\n" : "TCP Disconnect\r\n");
+    }
+}
+
+/*********************************************************************
+ * @fn      WCHNET_HandleGlobalInt
+ *
+ * @brief   Global Interrupt Handle
+ *
+ * @return  none
+ */
+void WCHNET_HandleGlobalInt(void)
+{
+    u8 intstat;
+    u16 i;
+    u8 socketint;
+
+    intstat = WCHNET_GetGlobalInt();                              //get global interrupt flag
+    if (intstat & GINT_STAT_UNREACH)                              //Unreachable interrupt
+    {
+        printf("GINT_STAT_UNREACH\r\n");
+    }
+    if (intstat & GINT_STAT_IP_CONFLI)                            //IP conflict
+    {
+        printf("GINT_STAT_IP_CONFLI\r\n");
+    }
+    if (intstat & GINT_STAT_PHY_CHANGE)                           //PHY status change
+    {
+        i = WCHNET_GetPHYStatus();
+        if (i & PHY_Linked_Status)
+            printf("PHY Link Success\r\n");
+    }
+    if (intstat & GINT_STAT_SOCKET) {                             //socket related interrupt
+        for (i = 0; i < WCHNET_MAX_SOCKET_NUM; i++) {
+            socketint = WCHNET_GetSocketInt(i);
+            if (socketint)
+                WCHNET_HandleSockInt(i, socketint);
+        }
+    }
+}
+
+u8 WCHNET_DHCPCallBack(u8 status, void *arg)
+{
+    u8 *p;
+
+    if(!status)
+    {
+        p = arg;
+        printf("DHCP Success\r\n");
+        memcpy(IPAddr, p, 4);
+        memcpy(GWIPAddr, &p[4], 4);
+        memcpy(IPMask, &p[8], 4);
+        printf("IPAddr: %d.%d.%d.%d \r\n", (u16)IPAddr[0], (u16)IPAddr[1],
+               (u16)IPAddr[2], (u16)IPAddr[3]);
+        printf("GWIPAddr: %d.%d.%d.%d \r\n", (u16)GWIPAddr[0], (u16)GWIPAddr[1],
+               (u16)GWIPAddr[2], (u16)GWIPAddr[3]);
+        printf("IPMask: %d.%d.%d.%d \r\n", (u16)IPMask[0], (u16)IPMask[1],
+               (u16)IPMask[2], (u16)IPMask[3]);
+        return READY;
+    }
+    else
+    {
+        printf("DHCP Fail %02x \r\n", status);
+        return NoREADY;
+    }
+}
+
+/*********************************************************************
+ * @fn      main
+ *
+ * @brief   Main program
+ *
+ * @return  none
+ */
+int main(void)
+{
+    u8 i;
+    SystemCoreClockUpdate();
+    Delay_Init();
+    USART_Printf_Init(115200);                                                  //USART initialize
+    UART_RxInit();
+    Delay_Ms(1000);
+    printf("iperf\r\n");
+    printf("SystemClk:%d\r\n", SystemCoreClock);
+    printf("ChipID:%08x\r\n", DBGMCU_GetCHIPID());
+    printf("net version:%x\n", WCHNET_GetVer());
+    if (WCHNET_LIB_VER != WCHNET_GetVer()) {
+        printf("version error.\n");
+    }
+    WCHNET_GetMacAddr(MACAddr);                                           //get the chip MAC address
+    printf("mac addr: ");
+    for(i = 0; i < 6; i++)
+        printf("%x ", MACAddr[i]);
+    printf("\n");
+    TIM2_Init();
+    i = ETH_LibInit(IPAddr, GWIPAddr, IPMask, MACAddr);                         //Ethernet library initialize
+    mStopIfError(i);
+    if (i == WCHNET_ERR_SUCCESS)
+        printf("WCHNET_LibInit Success\r\n");
+    WCHNET_DHCPStart(WCHNET_DHCPCallBack);                                //Start DHCP
+
+    Iperf_Pattern(TxPattern, sizeof(TxPattern));
+    Iperf_Pattern(UdpDatagram, sizeof(UdpDatagram));
+    WCHNET_CreateTcpSocketListen();                                             //iperf -c <board>
+    WCHNET_CreateUdpSocket();                                                   //iperf -c <board> -u
+
+    while(1)
+    {
+        NetEventPending = 0;
+        /*Ethernet library main task function,
+         * which needs to be called after every network interrupt*/
+        WCHNET_MainTask();
+        /*Query the Ethernet global interrupt,
+         * if there is an interrupt, call the global interrupt handler*/
+        if(WCHNET_QueryGlobalInt())
+        {
+            WCHNET_HandleGlobalInt();
+            NetEventPending = 1;                                //Let WCHNET send the replies before sleeping
+        }
+        if(UartReady)
+        {
+            Iperf_Command(UartLine);
+            UartLen = 0;
+            UartReady = 0;
+        }
+        /*Source tests, reports*/
+        if(Iperf_Task())
+        {
+            NetEventPending = 1;
+        }
+        /*Sleep until the next frame, timer tick, command or link change*/
+        Net_Idle();
+    }
+}
@@ -0,0 +1,41 @@
+/********************************** (C) COPYRIGHT *******************************
+* File Name          : net_config.h
+* Author             : WCH
+* Version            : V1.30
+* Date               : 2022/06/02
+* Description        : This file contains the configurations of 
+*                      Ethernet protocol stack library
+*********************************************************************************
+* Copyright (c) 2021 Nanjing Qinheng Microelectronics Co., Ltd.
+* Attention: This software (modified or not) and binary are used for 
+* microcontroller manufactured by Nanjing Qinheng Microelectronics.
+*******************************************************************************/
+#ifndef __NET_CONFIG_H__
+#define __NET_CONFIG_H__
+
+/*********************************************************************
+ * Settings of the iperf example, tuned for throughput instead of many
+ * connections. The rest is in lib/NetLib/net_config_defaults.h.
+ */
+
+/* With board_build.wchnet_ram, gen_net_config.py sizes these instead */
+#ifndef WCHNET_AUTO_SIZE
+#define WCHNET_NUM_IPRAW              0  /* Number of IPRAW connections */
+
+#define WCHNET_NUM_UDP                2  /* The number of UDP connections, sink and source */
+
+#define WCHNET_NUM_TCP                2  /* Number of TCP connections, sink and source */
+
+#define WCHNET_NUM_TCP_LISTEN         1  /* Number of TCP listening */
+
+/* A TCP window of four segments */
+#define RECE_BUF_LEN                  (WCHNET_TCP_MSS*4)   /* socket receive buffer size */
+
+#define WCHNET_NUM_TCP_SEG            (WCHNET_NUM_TCP*4)   /* The number of TCP segments used to send */
+#endif
+
+#define CFG0_TCP_SEND_COPY            0     /* TCP send buffer copy, 1: copy, 0: not copy, the source sends a constant pattern */
+
+#include "net_config_defaults.h"
+
+#endif
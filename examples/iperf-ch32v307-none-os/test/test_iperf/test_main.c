@@ -0,0 +1,220 @@
+/*
+ * Host tests of the iperf2 streams in lib/Iperf, run with
+ * "pio test -e native".
+ */
+#include <string.h>
+#include <unity.h>
+#include "iperf.h"
+
+static Iperf_Stream_t s;
+
+static u32 get32(const u8 *p)
+{
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+/* datagram with a send time, the length does not matter for the counters */
+static u8 recv(s32 id, u32 sent, u32 now)
+{
+    u8 buf[IPERF_UDP_LEN];
+
+    Iperf_Pattern(buf, sizeof(buf));
+    Iperf_UdpHead(buf, id, sent);
+    return Iperf_UdpRecv(&s, buf, sizeof(buf), now);
+}
+
+/* Ethernet / IPv4 / TCP frame of the stream with len bytes of data */
+static u32 tcp_frame(u8 *frame, u16 port, u32 seq, u16 len)
+{
+    memset(frame, 0, 14 + 20 + 20);
+    frame[12] = 0x08;
+    frame[14] = 0x45;
+    frame[16] = (20 + 20 + len) >> 8;
+    frame[17] = (u8)(20 + 20 + len);
+    frame[23] = 6;
+    frame[34] = port >> 8;
+    frame[35] = (u8)port;
+    frame[38] = seq >> 24;
+    frame[39] = seq >> 16;
+    frame[40] = seq >> 8;
+    frame[41] = seq;
+    frame[46] = 5 << 4;
+    return 14 + 20 + 20 + len;
+}
+
+void setUp(void)
+{
+    memset(&s, 0, sizeof(s));
+}
+
+void tearDown(void)
+{
+}
+
+static void test_udp_head(void)
+{
+    u8 buf[IPERF_UDP_HEAD_LEN];
+
+    Iperf_UdpHead(buf, 7, 12345678);
+    TEST_ASSERT_EQUAL_HEX32(7, get32(buf));
+    TEST_ASSERT_EQUAL(12, get32(buf + 4));
+    TEST_ASSERT_EQUAL(345678, get32(buf + 8));
+    Iperf_UdpHead(buf, -7, 0);
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFF9, get32(buf));
+}
+
+static void test_udp_loss_and_reorder(void)
+{
+    Iperf_Start(&s, IPERF_UDP_SINK, 1000);
+    TEST_ASSERT_EQUAL(0, recv(0, 0, 1000));
+    TEST_ASSERT_EQUAL(0, recv(1, 0, 1000));
+    TEST_ASSERT_EQUAL(0, recv(4, 0, 1000));                 /* 2 and 3 lost */
+    TEST_ASSERT_EQUAL(2, s.lost);
+    TEST_ASSERT_EQUAL(0, recv(2, 0, 1000));                 /* 2 was late */
+    TEST_ASSERT_EQUAL(1, s.lost);
+    TEST_ASSERT_EQUAL(1, s.outorder);
+    TEST_ASSERT_EQUAL(4, s.datagrams);
+    TEST_ASSERT_EQUAL(4 * IPERF_UDP_LEN, s.bytes);
+    TEST_ASSERT_EQUAL(1, recv(-5, 0, 1000));                /* end of the test, not counted */
+    TEST_ASSERT_EQUAL(4, s.datagrams);
+}
+
+static void test_udp_jitter(void)
+{
+    u32 i;
+
+    Iperf_Start(&s, IPERF_UDP_SINK, 0);
+    /* constant transit time: no jitter, whatever the clock offset */
+    for(i = 0; i < 10; i++)
+        recv(i, 5000000 + i * 1000, i * 1000);
+    TEST_ASSERT_EQUAL(0, s.jitter);
+    /* transit alternating by 1600 us converges to 1600 us */
+    for(; i < 1000; i++)
+        recv(i, 5000000 + i * 1000, i * 1000 + (i & 1) * 1600);
+    TEST_ASSERT_TRUE(s.jitter >> 4 > 1500 && s.jitter >> 4 <= 1600);
+}
+
+static void test_udp_report(void)
+{
+    u8 fin[IPERF_UDP_HEAD_LEN], buf[IPERF_UDP_REPORT_LEN];
+    u8 *hdr = buf + IPERF_UDP_HEAD_LEN;
+    Iperf_Stream_t source;
+
+    Iperf_Start(&s, IPERF_UDP_SINK, 1000000);
+    recv(0, 0, 1000000);
+    recv(2, 0, 1000000);
+    s.jitter = 2500 << 4;
+    Iperf_UdpHead(fin, -3, 0);
+    TEST_ASSERT_EQUAL(IPERF_UDP_REPORT_LEN, Iperf_UdpReport(&s, fin, buf, 3500000));
+    TEST_ASSERT_EQUAL_MEMORY(fin, buf, IPERF_UDP_HEAD_LEN);
+    TEST_ASSERT_EQUAL_HEX32(IPERF_HEADER_VERSION1, get32(hdr));
+    TEST_ASSERT_EQUAL(0, get32(hdr + 4));
+    TEST_ASSERT_EQUAL(2 * IPERF_UDP_LEN, get32(hdr + 8));
+    TEST_ASSERT_EQUAL(2, get32(hdr + 12));                  /* 2.5 s */
+    TEST_ASSERT_EQUAL(500000, get32(hdr + 16));
+    TEST_ASSERT_EQUAL(1, get32(hdr + 20));                  /* lost */
+    TEST_ASSERT_EQUAL(0, get32(hdr + 24));
+    TEST_ASSERT_EQUAL(3, get32(hdr + 28));                  /* datagrams */
+    TEST_ASSERT_EQUAL(0, get32(hdr + 32));
+    TEST_ASSERT_EQUAL(2500, get32(hdr + 36));
+
+    /* a UDP source reads the same report from "iperf -s -u" */
+    memset(&source, 0, sizeof(source));
+    Iperf_Start(&source, IPERF_UDP_SOURCE, 0);
+    TEST_ASSERT_EQUAL(0, Iperf_UdpServerReport(&source, buf, IPERF_UDP_HEAD_LEN));
+    TEST_ASSERT_EQUAL(1, Iperf_UdpServerReport(&source, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(1, source.lost);
+    TEST_ASSERT_EQUAL(2, source.udp_id);
+    TEST_ASSERT_EQUAL(2500, source.jitter >> 4);
+}
+
+static void test_tcp_retransmissions(void)
+{
+    u8 frame[14 + 20 + 20 + 1460];
+
+    s.port = 50000;
+    Iperf_Start(&s, IPERF_TCP_SOURCE, 0);
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0xFFFFF000, 1460));
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0xFFFFF5B4, 1460));
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0x00000168, 1460)); /* across the wrap */
+    TEST_ASSERT_EQUAL(0, s.retrans);
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0xFFFFF5B4, 1460));
+    TEST_ASSERT_EQUAL(1, s.retrans);
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0x0000071C, 0));    /* ACK only */
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50001, 0, 1460));          /* other port */
+    TEST_ASSERT_EQUAL(1, s.retrans);
+    TEST_ASSERT_EQUAL(4, s.datagrams);
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0x0000071C, 1460));
+    TEST_ASSERT_EQUAL(1, s.retrans);
+
+    /* only a TCP source counts */
+    s.mode = IPERF_TCP_SINK;
+    Iperf_TxFrame(&s, frame, tcp_frame(frame, 50000, 0, 1460));
+    TEST_ASSERT_EQUAL(1, s.retrans);
+}
+
+static void test_format(void)
+{
+    char line[128];
+
+    Iperf_Start(&s, IPERF_TCP_SOURCE, 1000000);
+    s.bytes = 1250000;
+    s.retrans = 3;
+    Iperf_Format(&s, line, sizeof(line), 2000000, 0);
+    TEST_ASSERT_EQUAL_STRING("[tcp source]   0.0-  1.0 sec    1220 KBytes  10.00 Mbits/sec retrans 3", line);
+    s.bytes += 625000;
+    Iperf_Format(&s, line, sizeof(line), 3000000, 0);
+    TEST_ASSERT_EQUAL_STRING("[tcp source]   1.0-  2.0 sec     610 KBytes   5.00 Mbits/sec retrans 3", line);
+    Iperf_Format(&s, line, sizeof(line), 3000000, 1);
+    TEST_ASSERT_EQUAL_STRING("[tcp source]   0.0-  2.0 sec    1831 KBytes   7.50 Mbits/sec retrans 3", line);
+
+    Iperf_Start(&s, IPERF_UDP_SINK, 0);
+    recv(0, 0, 0);
+    recv(3, 0, 0);
+    s.jitter = 1234 << 4;
+    Iperf_Format(&s, line, sizeof(line), 500000, 1);
+    TEST_ASSERT_EQUAL_STRING("[udp sink]   0.0-  0.5 sec       2 KBytes   0.04 Mbits/sec"
+                             " jitter 1.234 ms lost 2/4 ooo 0", line);
+    TEST_ASSERT_EQUAL(19, Iperf_Format(&s, line, 20, 500000, 1));
+}
+
+static void test_commands(void)
+{
+    Iperf_Cmd_t cmd;
+
+    TEST_ASSERT_EQUAL(IPERF_TCP_SOURCE, Iperf_ParseCmd("tcp 192.168.1.10", &cmd));
+    TEST_ASSERT_EQUAL_MEMORY("\xC0\xA8\x01\x0A", cmd.ip, 4);
+    TEST_ASSERT_EQUAL(IPERF_PORT, cmd.port);
+    TEST_ASSERT_EQUAL(IPERF_TIME, cmd.time);
+    TEST_ASSERT_EQUAL(IPERF_UDP_SOURCE, Iperf_ParseCmd(" udp 10.0.0.1 5002 30 20M ", &cmd));
+    TEST_ASSERT_EQUAL(5002, cmd.port);
+    TEST_ASSERT_EQUAL(30, cmd.time);
+    TEST_ASSERT_EQUAL(20000, cmd.rate);
+    TEST_ASSERT_EQUAL(IPERF_UDP_SOURCE, Iperf_ParseCmd("udp 10.0.0.1 5001 5 500K", &cmd));
+    TEST_ASSERT_EQUAL(500, cmd.rate);
+    TEST_ASSERT_EQUAL(IPERF_UDP_SOURCE, Iperf_ParseCmd("udp 10.0.0.1 5001 5 2000000", &cmd));
+    TEST_ASSERT_EQUAL(2000, cmd.rate);
+    TEST_ASSERT_EQUAL(IPERF_STOP, Iperf_ParseCmd("stop", &cmd));
+
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("tcp", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("tcp 10.0.0", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("tcp 10.0.0.256", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("tcp 10.0.0.1 0", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("tcp 10.0.0.1 5001 10 1M", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("udp 10.0.0.1 5001 10 1G", &cmd));
+    TEST_ASSERT_EQUAL(IPERF_IDLE, Iperf_ParseCmd("stopp", &cmd));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_udp_head);
+    RUN_TEST(test_udp_loss_and_reorder);
+    RUN_TEST(test_udp_jitter);
+    RUN_TEST(test_udp_report);
+    RUN_TEST(test_tcp_retransmissions);
+    RUN_TEST(test_format);
+    RUN_TEST(test_commands);
+    return UNITY_END();
+}
@@ -0,0 +1,175 @@
+/*
+ * Host tests of the UART <-> USB ring buffer handling in src/UART/UART.c,
+ * run with "pio test -e native". The DMA counters and the USART status are
+ * set by hand, as the hardware would do it.
+ */
+#include <unity.h>
+#include "UART.h"
+#include "host_shim.h"
+
+/* the RX DMA has written len more bytes into the circular buffer */
+static void rx_dma_receive(uint32_t len)
+{
+    uint32_t pos = DEF_UARTx_RX_BUF_LEN - DEF_UART2_RX_DMA_CH->CNTR;
+
+    pos = (pos + len) % DEF_UARTx_RX_BUF_LEN;
+    DEF_UART2_RX_DMA_CH->CNTR = DEF_UARTx_RX_BUF_LEN - pos;
+}
+
+/* the USB IN transfer of endpoint 3 has completed */
+static void usb_upload_done(void)
+{
+    Uart.USB_Up_IngFlag = 0;
+}
+
+void setUp(void)
+{
+    host_shim_reset();
+    UART2_Init(1, DEF_UARTx_BAUDRATE, DEF_UARTx_STOPBIT, DEF_UARTx_PARITY);
+    /* as after the first UART2_DataRx_Deal() call */
+    UARTx_Rx_DMALastCount = DEF_UART2_RX_DMA_CH->CNTR;
+}
+
+void tearDown(void)
+{
+}
+
+static void test_rx_uploads_full_packets(void)
+{
+    rx_dma_receive(100);
+    UART2_DataRx_Deal();
+    TEST_ASSERT_EQUAL_UINT32(DEF_USBD_FS_PACK_SIZE, USBOTG_FS->UEP3_TX_LEN);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(uintptr_t)&UART2_Rx_Buf[0], USBOTG_FS->UEP3_DMA);
+    TEST_ASSERT_EQUAL(100 - DEF_USBD_FS_PACK_SIZE, Uart.Rx_RemainLen);
+    TEST_ASSERT_EQUAL(DEF_USBD_FS_PACK_SIZE, Uart.Rx_DealPtr);
+    TEST_ASSERT_EQUAL_UINT8(1, Uart.USB_Up_IngFlag);
+    TEST_ASSERT_EQUAL_UINT8(1, Uart.USB_Up_Pack0_Flag);
+
+    /* nothing is uploaded while the previous packet is in flight */
+    USBOTG_FS->UEP3_TX_LEN = 0;
+    UART2_DataRx_Deal();
+    TEST_ASSERT_EQUAL_UINT32(0, USBOTG_FS->UEP3_TX_LEN);
+}
+
+static void test_rx_short_packet_after_timeout(void)
+{
+    rx_dma_receive(10);
+    UART2_DataRx_Deal();
+    /* less than a packet, wait for more data */
+    TEST_ASSERT_EQUAL_UINT8(0, Uart.USB_Up_IngFlag);
+    TEST_ASSERT_EQUAL(10, Uart.Rx_RemainLen);
+
+    Uart.Rx_TimeOut = Uart.Rx_TimeOutMax;
+    UART2_DataRx_Deal();
+    TEST_ASSERT_EQUAL_UINT32(10, USBOTG_FS->UEP3_TX_LEN);
+    TEST_ASSERT_EQUAL(0, Uart.Rx_RemainLen);
+    TEST_ASSERT_EQUAL(10, Uart.Rx_DealPtr);
+    TEST_ASSERT_EQUAL_UINT8(0, Uart.USB_Up_Pack0_Flag);
+}
+
+static void test_rx_wraps_around(void)
+{
+    /* DMA and processing pointer 8 bytes before the end of the buffer */
+    rx_dma_receive(DEF_UARTx_RX_BUF_LEN - 8);
+    UARTx_Rx_DMALastCount = DEF_UART2_RX_DMA_CH->CNTR;
+    Uart.Rx_DealPtr = DEF_UARTx_RX_BUF_LEN - 8;
+
+    rx_dma_receive(20);
+    Uart.Rx_TimeOut = Uart.Rx_TimeOutMax;
+    UART2_DataRx_Deal();
+    TEST_ASSERT_EQUAL(20, Uart.Rx_RemainLen + USBOTG_FS->UEP3_TX_LEN);
+    /* the first upload stops at the end of the buffer */
+    TEST_ASSERT_EQUAL_UINT32(8, USBOTG_FS->UEP3_TX_LEN);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(uintptr_t)&UART2_Rx_Buf[DEF_UARTx_RX_BUF_LEN - 8], USBOTG_FS->UEP3_DMA);
+    TEST_ASSERT_EQUAL(0, Uart.Rx_DealPtr);
+
+    usb_upload_done();
+    Uart.Rx_TimeOut = Uart.Rx_TimeOutMax;
+    UART2_DataRx_Deal();
+    TEST_ASSERT_EQUAL_UINT32(12, USBOTG_FS->UEP3_TX_LEN);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(uintptr_t)&UART2_Rx_Buf[0], USBOTG_FS->UEP3_DMA);
+    TEST_ASSERT_EQUAL(0, Uart.Rx_RemainLen);
+}
+
+static void test_rx_overflow_is_dropped(void)
+{
+    Uart.USB_Up_IngFlag = 1;
+    rx_dma_receive(DEF_UARTx_RX_BUF_LEN - 16);
+    UART2_DataRx_Deal();
+    rx_dma_receive(32);
+    UART2_DataRx_Deal();
+    TEST_ASSERT_EQUAL(DEF_UARTx_RX_BUF_LEN - 16, Uart.Rx_RemainLen);
+}
+
+static void test_tx_sends_packets_in_order(void)
+{
+    Uart.Tx_PackLen[0] = 10;
+    Uart.Tx_PackLen[1] = DEF_USB_FS_PACK_LEN;
+    Uart.Tx_LoadNum = 2;
+    Uart.Tx_RemainNum = 2;
+
+    UART2_DataTx_Deal();
+    TEST_ASSERT_EQUAL_UINT8(1, Uart.Tx_Flag);
+    TEST_ASSERT_EQUAL_UINT32(10, DEF_UART2_TX_DMA_CH->CNTR);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(uintptr_t)&UART2_Tx_Buf[0], DEF_UART2_TX_DMA_CH->MADDR);
+
+    /* DMA done, transmission complete */
+    DEF_UART2_TX_DMA_CH->CNTR = 0;
+    USART2->STATR |= USART_FLAG_TC;
+    UART2_DataTx_Deal();
+    TEST_ASSERT_EQUAL_UINT8(0, Uart.Tx_Flag);
+    TEST_ASSERT_EQUAL(1, Uart.Tx_DealNum);
+    TEST_ASSERT_EQUAL(1, Uart.Tx_RemainNum);
+    TEST_ASSERT_EQUAL(0, Uart.Tx_PackLen[0]);
+
+    UART2_DataTx_Deal();
+    TEST_ASSERT_EQUAL_UINT32(DEF_USB_FS_PACK_LEN, DEF_UART2_TX_DMA_CH->CNTR);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(uintptr_t)&UART2_Tx_Buf[DEF_USB_FS_PACK_LEN], DEF_UART2_TX_DMA_CH->MADDR);
+}
+
+static void test_tx_resumes_partial_packet(void)
+{
+    Uart.Tx_PackLen[0] = 10;
+    Uart.Tx_LoadNum = 1;
+    Uart.Tx_RemainNum = 1;
+    UART2_DataTx_Deal();
+
+    /* stopped with 4 bytes left */
+    DEF_UART2_TX_DMA_CH->CNTR = 4;
+    USART2->STATR |= USART_FLAG_TC;
+    UART2_DataTx_Deal();
+    TEST_ASSERT_EQUAL(0, Uart.Tx_DealNum);
+    TEST_ASSERT_EQUAL(1, Uart.Tx_RemainNum);
+
+    UART2_DataTx_Deal();
+    TEST_ASSERT_EQUAL_UINT32(4, DEF_UART2_TX_DMA_CH->CNTR);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(uintptr_t)&UART2_Tx_Buf[6], DEF_UART2_TX_DMA_CH->MADDR);
+}
+
+static void test_tx_restarts_usb_download(void)
+{
+    Uart.Tx_PackLen[0] = 10;
+    Uart.Tx_LoadNum = 1;
+    Uart.Tx_RemainNum = 1;
+    Uart.USB_Down_StopFlag = 1;
+    USBOTG_FS->UEP2_RX_CTRL = USBFS_UEP_R_RES_MASK;
+    UART2_DataTx_Deal();
+    DEF_UART2_TX_DMA_CH->CNTR = 0;
+    USART2->STATR |= USART_FLAG_TC;
+    UART2_DataTx_Deal();
+    TEST_ASSERT_EQUAL_UINT8(0, Uart.USB_Down_StopFlag);
+    TEST_ASSERT_EQUAL_HEX8(USBFS_UEP_R_RES_ACK, USBOTG_FS->UEP2_RX_CTRL & USBFS_UEP_R_RES_MASK);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rx_uploads_full_packets);
+    RUN_TEST(test_rx_short_packet_after_timeout);
+    RUN_TEST(test_rx_wraps_around);
+    RUN_TEST(test_rx_overflow_is_dropped);
+    RUN_TEST(test_tx_sends_packets_in_order);
+    RUN_TEST(test_tx_resumes_partial_packet);
+    RUN_TEST(test_tx_restarts_usb_download);
+    return UNITY_END();
+}
@@ -0,0 +1,114 @@
+/*
+ * Host tests of the Source_Capabilities handling in src/PD_Process.c,
+ * run with "pio test -e native".
+ */
+#include <string.h>
+#include <unity.h>
+#include "debug.h"
+#include "PD_Process.h"
+#include "host_shim.h"
+
+/* from src/main.c */
+UINT8 Tim_Ms_Cnt;
+
+/* not declared in PD_Process.h */
+extern UINT8 Adapter_SrcCap[30];
+extern void PD_Save_Adapter_SrcCap(void);
+
+/* 5V 3A, 9V 2A and 12V 1.5A fixed supply PDOs, little endian */
+static const UINT8 pdo_5v3a[4] = {0x2C, 0x91, 0x01, 0x3E};
+static const UINT8 pdo_9v2a[4] = {0xC8, 0xD0, 0x02, 0x00};
+static const UINT8 pdo_12v1a5[4] = {0x96, 0xC0, 0x03, 0x00};
+/* 3.3V - 11V 3A programmable power supply APDO */
+static const UINT8 apdo_pps[4] = {0x3C, 0x21, 0xDC, 0xC0};
+
+static void load_src_cap(const UINT8 *pdos[], UINT8 count)
+{
+    UINT8 i;
+
+    memset(PD_Rx_Buf, 0, sizeof(PD_Rx_Buf));
+    PD_Rx_Buf[0] = 0xA1;
+    PD_Rx_Buf[1] = (UINT8)((count << 4) | 0x01);
+    for(i = 0; i < count; i++)
+        memcpy(&PD_Rx_Buf[2 + (i << 2)], pdos[i], 4);
+}
+
+void setUp(void)
+{
+    host_shim_reset();
+    memset(Adapter_SrcCap, 0, sizeof(Adapter_SrcCap));
+    PDO_Len = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static void test_pdo_analyse(void)
+{
+    UINT8 srccap[8];
+    UINT16 current, voltage;
+
+    memcpy(&srccap[0], pdo_5v3a, 4);
+    memcpy(&srccap[4], pdo_9v2a, 4);
+    PD_PDO_Analyse(1, srccap, &current, &voltage);
+    TEST_ASSERT_EQUAL_UINT16(3000, current);
+    TEST_ASSERT_EQUAL_UINT16(5000, voltage);
+    PD_PDO_Analyse(2, srccap, &current, &voltage);
+    TEST_ASSERT_EQUAL_UINT16(2000, current);
+    TEST_ASSERT_EQUAL_UINT16(9000, voltage);
+}
+
+static void test_pdo_analyse_optional_outputs(void)
+{
+    UINT16 current = 0, voltage = 0;
+
+    PD_PDO_Analyse(1, (UINT8 *)pdo_12v1a5, &current, NULL);
+    TEST_ASSERT_EQUAL_UINT16(1500, current);
+    PD_PDO_Analyse(1, (UINT8 *)pdo_12v1a5, NULL, &voltage);
+    TEST_ASSERT_EQUAL_UINT16(12000, voltage);
+}
+
+static void test_save_src_cap_fixed_only(void)
+{
+    const UINT8 *pdos[] = {pdo_5v3a, pdo_9v2a, pdo_12v1a5};
+
+    load_src_cap(pdos, 3);
+    PD_Save_Adapter_SrcCap();
+    TEST_ASSERT_EQUAL_UINT8(3, PDO_Len);
+    TEST_ASSERT_EQUAL_UINT8(3, Adapter_SrcCap[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x31, PD_Rx_Buf[1]);
+    TEST_ASSERT_EQUAL_MEMORY(pdo_5v3a, &Adapter_SrcCap[1], 4);
+    TEST_ASSERT_EQUAL_MEMORY(pdo_9v2a, &Adapter_SrcCap[5], 4);
+    TEST_ASSERT_EQUAL_MEMORY(pdo_12v1a5, &Adapter_SrcCap[9], 4);
+}
+
+static void test_save_src_cap_drops_pps(void)
+{
+    const UINT8 *pdos[] = {pdo_5v3a, pdo_9v2a, apdo_pps, pdo_12v1a5};
+    UINT16 current, voltage;
+
+    load_src_cap(pdos, 4);
+    PD_Rx_Buf[1] |= 0x80;
+    PD_Save_Adapter_SrcCap();
+    /* everything from the first APDO on is dropped, the header keeps its other bits */
+    TEST_ASSERT_EQUAL_UINT8(2, PDO_Len);
+    TEST_ASSERT_EQUAL_UINT8(2, Adapter_SrcCap[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xA1, PD_Rx_Buf[1]);
+    TEST_ASSERT_EQUAL_MEMORY(pdo_9v2a, &Adapter_SrcCap[5], 4);
+    /* the first PDO is rewritten as dual-role / USB capable fixed supply */
+    TEST_ASSERT_EQUAL_HEX8(0x3E, Adapter_SrcCap[4]);
+    PD_PDO_Analyse(1, &Adapter_SrcCap[1], &current, &voltage);
+    TEST_ASSERT_EQUAL_UINT16(3000, current);
+    TEST_ASSERT_EQUAL_UINT16(5000, voltage);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_pdo_analyse);
+    RUN_TEST(test_pdo_analyse_optional_outputs);
+    RUN_TEST(test_save_src_cap_fixed_only);
+    RUN_TEST(test_save_src_cap_drops_pps);
+    return UNITY_END();
+}
@@ -0,0 +1,309 @@
+/*
+ * Configuration store of the webserver example.
+ *
+ * The settings are appended as records (key, length, data, CRC-32) to a
+ * ring of CFG_STORE_PAGES flash pages, instead of erasing and rewriting a
+ * fixed page for every change. The CRC is programmed last, so a record
+ * that was cut off by a power loss is ignored and the previous one stays
+ * valid. When the current page is full, the next page of the ring (the
+ * oldest) is erased and starts with a copy of the current records, so the
+ * erases go round all pages and every page holds all settings.
+ *
+ * Cfg_Init() scans the pages once at boot and keeps the address of the
+ * latest record of each key, Cfg_Read() then just copies from there.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "cfg_store.h"
+
+static u32 cfg_index[CFG_KEYS_MAX];                     //Address of the latest record of each key, 0 if none
+static s8  cfg_head = -1;                               //Page records are appended to, -1 before the first one
+static u8  cfg_next;                                    //Next free slot in that page
+static u32 cfg_seq;                                     //Sequence number of that page
+
+#define CFG_PAGE_ADDR(page)       (CFG_STORE_ADDR + (u32)(page) * CFG_PAGE_SIZE)
+#define CFG_SLOT_ADDR(page, slot) (CFG_PAGE_ADDR(page) + (u32)(slot) * CFG_SLOT_SIZE)
+
+/*********************************************************************
+ * @fn      Cfg_Crc32
+ *
+ * @brief   CRC-32 (IEEE 802.3), bitwise, the store only checks a few
+ *          slots at boot.
+ *
+ * @param   buf - data
+ *          len - data length
+ *
+ * @return  CRC
+ */
+u32 Cfg_Crc32(const u8 *buf, u32 len)
+{
+    u32 crc = 0xFFFFFFFF;
+    u8 i;
+
+    while(len--)
+    {
+        crc ^= *buf++;
+        for(i = 0; i < 8; i++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+/*********************************************************************
+ * @fn      Cfg_FlashErase
+ *
+ * @brief   Erase one 256 byte page. Weak, a host test provides its own,
+ *          the host shim does not emulate the flash controller.
+ *
+ * @param   addr - page address
+ *
+ * @return  none
+ */
+__attribute__((weak)) void Cfg_FlashErase(u32 addr)
+{
+    FLASH_Unlock_Fast();
+    FLASH_ErasePage_Fast(addr);
+    FLASH_Lock_Fast();
+}
+
+/*********************************************************************
+ * @fn      Cfg_FlashWrite
+ *
+ * @brief   Program words in ascending order.
+ *
+ * @param   addr - destination, erased
+ *          buf - data, word aligned
+ *          len - data length, multiple of 4
+ *
+ * @return  FLASH_COMPLETE or error
+ */
+static FLASH_Status Cfg_FlashWrite(u32 addr, const u32 *buf, u32 len)
+{
+    FLASH_Status status = FLASH_COMPLETE;
+    u32 end = addr + len;
+
+    FLASH_Unlock();
+    while(addr < end && status == FLASH_COMPLETE)
+    {
+        status = FLASH_ProgramWord(addr, *buf++);
+        addr += 4;
+    }
+    FLASH_Lock();
+    return status;
+}
+
+/*********************************************************************
+ * @fn      Cfg_PageValid
+ *
+ * @brief   Check the header of a page.
+ *
+ * @param   page - page number
+ *
+ * @return  header, NULL if the page is erased or its header was cut off
+ */
+static const Cfg_PageHead_t *Cfg_PageValid(u8 page)
+{
+    const Cfg_PageHead_t *head = (const Cfg_PageHead_t *)(uintptr_t)CFG_PAGE_ADDR(page);
+
+    if(head->magic != CFG_PAGE_MAGIC ||
+       head->crc != Cfg_Crc32((const u8 *)head, offsetof(Cfg_PageHead_t, crc)))
+        return NULL;
+    return head;
+}
+
+/*********************************************************************
+ * @fn      Cfg_RecordValid
+ *
+ * @brief   Check a record slot.
+ *
+ * @param   rec - slot
+ *
+ * @return  READY if the record is complete
+ */
+static ErrorStatus Cfg_RecordValid(const Cfg_Record_t *rec)
+{
+    if(rec->key >= CFG_KEYS_MAX || rec->len > CFG_DATA_LEN ||
+       rec->crc != Cfg_Crc32((const u8 *)rec, offsetof(Cfg_Record_t, crc)))
+        return NoREADY;
+    return READY;
+}
+
+/*********************************************************************
+ * @fn      Cfg_Append
+ *
+ * @brief   Append a record to the current page, which has a free slot.
+ *
+ * @param   key - key
+ *          buf - value
+ *          len - value length
+ *
+ * @return  READY if the record was written and reads back correctly
+ */
+static ErrorStatus Cfg_Append(u8 key, const u8 *buf, u8 len)
+{
+    Cfg_Record_t rec;
+    u32 addr = CFG_SLOT_ADDR(cfg_head, cfg_next);
+
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = CFG_RECORD_MAGIC;
+    rec.key = key;
+    rec.len = len;
+    memcpy(rec.data, buf, len);
+    rec.crc = Cfg_Crc32((const u8 *)&rec, offsetof(Cfg_Record_t, crc));
+    cfg_next++;                                                 //The slot is used even if writing fails
+    Cfg_FlashWrite(addr, (const u32 *)&rec, sizeof(rec));
+    if(Cfg_RecordValid((const Cfg_Record_t *)(uintptr_t)addr) != READY)
+        return NoREADY;
+    cfg_index[key] = addr;
+    return READY;
+}
+
+/*********************************************************************
+ * @fn      Cfg_NewPage
+ *
+ * @brief   Continue in the next page of the ring: erase it, write its
+ *          header and copy the current records into it. The page that
+ *          is erased holds no current record, they are all in the
+ *          current page.
+ *
+ * @return  READY if all records were copied
+ */
+static ErrorStatus Cfg_NewPage(void)
+{
+    Cfg_PageHead_t head;
+    const Cfg_Record_t *rec;
+    ErrorStatus status = READY;
+    u8 key;
+
+    cfg_head = (cfg_head + 1) % CFG_STORE_PAGES;
+    Cfg_FlashErase(CFG_PAGE_ADDR(cfg_head));
+    head.magic = CFG_PAGE_MAGIC;
+    head.seq = ++cfg_seq;
+    head.crc = Cfg_Crc32((const u8 *)&head, offsetof(Cfg_PageHead_t, crc));
+    Cfg_FlashWrite(CFG_PAGE_ADDR(cfg_head), (const u32 *)&head, sizeof(head));
+    cfg_next = 1;
+    for(key = 0; key < CFG_KEYS_MAX; key++)
+    {
+        if(cfg_index[key] == 0)
+            continue;
+        rec = (const Cfg_Record_t *)(uintptr_t)cfg_index[key];
+        if(Cfg_Append(key, rec->data, rec->len) != READY)
+            status = NoREADY;
+    }
+    return status;
+}
+
+/*********************************************************************
+ * @fn      Cfg_Init
+ *
+ * @brief   Build the index of the latest records. Pages are replayed in
+ *          the order they were started, slots in the order they were
+ *          written. If a page change was interrupted, the records that
+ *          are not in the newest page yet are copied now.
+ *
+ * @return  none
+ */
+void Cfg_Init(void)
+{
+    const Cfg_PageHead_t *head;
+    const Cfg_Record_t *rec;
+    u32 seq = 0, next;
+    u8 page, slot, key;
+    s8 found;
+
+    memset(cfg_index, 0, sizeof(cfg_index));
+    cfg_head = -1;
+    cfg_next = CFG_SLOTS;
+    cfg_seq = 0;
+    while(1)
+    {
+        /*Next page in start order: the lowest sequence number above seq*/
+        found = -1;
+        next = 0;
+        for(page = 0; page < CFG_STORE_PAGES; page++)
+        {
+            head = Cfg_PageValid(page);
+            if(head != NULL && head->seq > seq && (found < 0 || head->seq < next))
+            {
+                found = page;
+                next = head->seq;
+            }
+        }
+        if(found < 0)
+            break;
+        seq = next;
+        cfg_head = found;
+        cfg_seq = seq;
+        for(slot = 1; slot < CFG_SLOTS; slot++)
+        {
+            rec = (const Cfg_Record_t *)(uintptr_t)CFG_SLOT_ADDR(found, slot);
+            if(rec->magic != CFG_RECORD_MAGIC)                  //Never written, end of the page
+                break;
+            if(Cfg_RecordValid(rec) == READY)
+                cfg_index[rec->key] = (u32)(uintptr_t)rec;
+        }
+        cfg_next = slot;
+    }
+    if(cfg_head < 0)
+        return;
+    for(key = 0; key < CFG_KEYS_MAX; key++)
+    {
+        if(cfg_index[key] == 0 ||
+           (cfg_index[key] - CFG_STORE_ADDR) / CFG_PAGE_SIZE == (u32)cfg_head)
+            continue;
+        rec = (const Cfg_Record_t *)(uintptr_t)cfg_index[key];
+        if(cfg_next < CFG_SLOTS)                                //Less than all keys were copied, so there is room
+            Cfg_Append(key, rec->data, rec->len);
+    }
+}
+
+/*********************************************************************
+ * @fn      Cfg_Read
+ *
+ * @brief   Read the latest value of a key.
+ *
+ * @param   key - key
+ *          buf - destination
+ *          len - size of buf
+ *
+ * @return  length of the value, 0 if there is none
+ */
+u8 Cfg_Read(u8 key, u8 *buf, u8 len)
+{
+    const Cfg_Record_t *rec;
+
+    if(key >= CFG_KEYS_MAX || cfg_index[key] == 0)
+        return 0;
+    rec = (const Cfg_Record_t *)(uintptr_t)cfg_index[key];
+    memcpy(buf, rec->data, rec->len < len ? rec->len : len);
+    return rec->len;
+}
+
+/*********************************************************************
+ * @fn      Cfg_Write
+ *
+ * @brief   Store a new value of a key. An unchanged value is not
+ *          written again.
+ *
+ * @param   key - key
+ *          buf - value
+ *          len - value length, at most CFG_DATA_LEN
+ *
+ * @return  READY if stored
+ */
+ErrorStatus Cfg_Write(u8 key, const u8 *buf, u8 len)
+{
+    const Cfg_Record_t *rec;
+
+    if(key >= CFG_KEYS_MAX || len > CFG_DATA_LEN)
+        return NoREADY;
+    if(cfg_index[key] != 0)
+    {
+        rec = (const Cfg_Record_t *)(uintptr_t)cfg_index[key];
+        if(rec->len == len && memcmp(rec->data, buf, len) == 0)
+            return READY;
+    }
+    if(cfg_head < 0 || cfg_next == CFG_SLOTS)
+        Cfg_NewPage();
+    return Cfg_Append(key, buf, len);
+}
@@ -0,0 +1,66 @@
+/*
+ * Configuration store of the webserver example: an append-only log of
+ * key / value records with CRC in a ring of flash pages, see cfg_store.c.
+ */
+#ifndef __CFG_STORE_H__
+#define __CFG_STORE_H__
+#include "debug.h"
+
+/*Flash region of the store, a ring of 256 byte pages
+ * erased with FLASH_ErasePage_Fast*/
+#ifndef CFG_STORE_ADDR
+#define CFG_STORE_ADDR            ((uint32_t)0x0803FC00) /* Start from 255K */
+#endif
+#ifndef CFG_STORE_PAGES
+#define CFG_STORE_PAGES           4                      /* At least 2 */
+#endif
+#define CFG_PAGE_SIZE             256
+
+/*Each page starts with a header slot, followed by record slots*/
+#define CFG_SLOT_SIZE             32
+#define CFG_SLOTS                 (CFG_PAGE_SIZE / CFG_SLOT_SIZE)
+#define CFG_DATA_LEN              (CFG_SLOT_SIZE - 8)    /* Record header and CRC take 8 bytes */
+#define CFG_KEYS_MAX              4                      /* Keys 0 .. CFG_KEYS_MAX - 1 */
+
+#define CFG_PAGE_MAGIC            0x47464357             /* "WCFG" */
+#define CFG_RECORD_MAGIC          0x5243                 /* "CR", neither 0xFFFF nor 0xE339 (erased flash) */
+
+#if CFG_STORE_PAGES < 2
+#error "CFG_STORE_PAGES Error,Please Configure CFG_STORE_PAGES >= 2"
+#endif
+#if CFG_KEYS_MAX > CFG_SLOTS - 2
+#error "CFG_KEYS_MAX Error,a page has to hold all keys and one more record"
+#endif
+
+/*Keys of the webserver settings*/
+#define CFG_KEY_BASIC             1
+#define CFG_KEY_PORT              2
+#define CFG_KEY_LOGIN             3
+
+typedef struct Cfg_Record                       //Record slot, the CRC is programmed last
+{
+    u16 magic;                                  //CFG_RECORD_MAGIC, programmed first
+    u8  key;
+    u8  len;
+    u8  data[CFG_DATA_LEN];
+    u32 crc;                                    //CRC-32 of magic .. data
+} Cfg_Record_t;
+
+typedef struct Cfg_PageHead                     //Header slot of a page
+{
+    u32 magic;                                  //CFG_PAGE_MAGIC
+    u32 seq;                                    //Incremented for every new page
+    u32 crc;                                    //CRC-32 of magic and seq
+} Cfg_PageHead_t;
+
+extern void Cfg_Init(void);
+
+extern u8 Cfg_Read(u8 key, u8 *buf, u8 len);
+
+extern ErrorStatus Cfg_Write(u8 key, const u8 *buf, u8 len);
+
+extern u32 Cfg_Crc32(const u8 *buf, u32 len);
+
+extern void Cfg_FlashErase(u32 addr);
+
+#endif
@@ -14,51 +14,58 @@
 #define	__HTTPS_H__
 #include "debug.h"
 #include "wchnet.h"
+#include "web_assets.h"
+#include "cfg_store.h"
 
-/*Address where configuration
- * information is stored*/
-#define PAGE_WRITE_START_ADDR     ((uint32_t)0x0803FC00) /* Start from 255K */
-#define PAGE_WRITE_END_ADDR       ((uint32_t)0x08040000) /* End at 256K */
-#define FLASH_PAGE_SIZE           256
-
-#define BASIC_CFG_ADDR            ((uint32_t)0x0803FC00)
-#define PORT_CFG_ADDR             ((uint32_t)0x0803FD00)
-#define LOGIN_CFG_ADDR            ((uint32_t)0x0803FE00)
+/*Configuration records, stored with Cfg_Write() (cfg_store.h)*/
 #define BASIC_CFG_LEN             (sizeof(Basic_Cfg_t))
 #define PORT_CFG_LEN              (sizeof(Port_Cfg_t))
 #define LOGIN_CFG_LEN             (sizeof(Login_Cfg_t))
 
 
 #define MAX_URL_SIZE              32
+#define HTTP_LINE_LEN             64                     /* Request line / header line, longer lines are cut */
+#define HTTP_BODY_LEN             192                    /* POST data of the configuration pages */
+#define WEB_VAR_LEN               30                     /* Value of a template variable, e.g. __ASIP */
 #define HTTP_SERVER_PORT          80
+#define HTTP_SESSIONS             WCHNET_NUM_TCP         /* At most one session per TCP connection */
+#define HTTP_IDLE_TIMEOUT         10000                  /* ms without progress before a connection is closed */
+#define HTTP_TX_QUEUE_LEN         4                      /* Pieces of a response waiting to be sent, per connection */
+#define HTTP_HEAD_LEN             200                    /* Response header, per connection */
 
-/* HTTP request method*/
+/* HTTP request method, GET and POST as in the route table (web_assets.h) */
 #define	METHOD_ERR		          0
-#define	METHOD_GET		          1
+#define	METHOD_GET		          WEB_METHOD_GET
 #define	METHOD_HEAD		          2
-#define	METHOD_POST		          3
+#define	METHOD_POST		          WEB_METHOD_POST
 
-/* HTTP request URL */
-#define	PTYPE_ERR		          0
-#define	PTYPE_HTML	              1
-#define	PTYPE_PNG		          2
-#define	PTYPE_CSS		          3
-#define PTYPE_GIF                 4
+/* Request parser state */
+#define HTTP_STATE_LINE           0                      /* Request line */
+#define HTTP_STATE_HEADER         1
+#define HTTP_STATE_BODY           2                      /* Content-Length bytes of data */
+#define HTTP_STATE_DONE           3                      /* Complete request in parser->request */
+#define HTTP_STATE_CLOSE          4                      /* Last request answered, connection is closed */
 
 /*WCHNET communication Mode*/
 #define MODE_TCPSERVER            0
 #define MODE_TCPCLIENT            1
 
-/* HTML Doc. for ERROR */
-#define RES_HTMLHEAD_OK "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nContent-Length:"
+/* files of the asset table (data/www), see MakeAssetResponse() */
+#define RES_ASSETHEAD_OK "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nContent-Length: %u\r\n%s%sETag: %s\r\nCache-Control: no-cache\r\n\r\n"
+
+/* pages of the template table (data/templates), filled in while sending */
+#define RES_TEMPLATEHEAD_OK "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nContent-Length: %u\r\nCache-Control: no-store\r\n\r\n"
+
+#define RES_NOT_MODIFIED "HTTP/1.1 304 Not Modified\r\n%sETag: %s\r\n\r\n"
 
-#define RES_PNGHEAD_OK  "HTTP/1.1 200 OK\r\nContent-Type: image/png\r\nContent-Length:"
-  
-#define RES_CSSHEAD_OK  "HTTP/1.1 200 OK\r\nContent-Type: text/css\r\nContent-Length:"
+/* files with a gzip and an uncompressed copy, for caches */
+#define RES_VARY_ENCODING "Vary: Accept-Encoding\r\n"
 
-#define RES_GIFHEAD_OK  "HTTP/1.1 200 OK\r\nContent-Type: image/gif\r\nContent-Length:"
+#define RES_NOT_FOUND "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n"
 
-#define RES_END "\r\n\r\n"
+#define RES_TOO_LARGE "HTTP/1.1 413 Content Too Large\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"
+
+#define RES_NOT_IMPLEMENTED "HTTP/1.1 501 Not Implemented\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"
 
 
 typedef struct Basic_Cfg                        //Basic configuration parameters
@@ -92,15 +99,50 @@ typedef struct Login_Cfg                         //Login configuration parameter
 typedef struct _st_http_request                 //Browser request information
 {
 	char	METHOD;					
-	char	TYPE;					
-	char	URL[MAX_URL_SIZE];
+	u8		KEEPALIVE;				//HTTP/1.1 without "Connection: close"
+	u8		TOOLARGE;				//Body did not fit into BODY
+	char	URL[MAX_URL_SIZE];		//Without the leading '/' and the query
+	char	ETAG[20];				//If-None-Match, empty if none
+	u8		GZIP;					//Accept-Encoding allows gzip
+	u16		BODYLEN;
+	char	BODY[HTTP_BODY_LEN];	//POST data, null-terminated
 }st_http_request;
 
-typedef struct Para_Tab                         //Configuration information parameter table
+typedef struct Http_Parser                      //Incremental request parser, per socket
+{
+    u8   state;                                 //HTTP_STATE_*
+    u8   linelen;
+    u32  bodyleft;                              //Body bytes still to come
+    char line[HTTP_LINE_LEN];                   //Current request / header line
+    st_http_request request;
+} Http_Parser_t;
+
+typedef struct Http_TxDesc                      //Piece of a response waiting to be sent
 {
-	char *para;                                 //Configuration item name
-	char value[30];                             //Configuration item value
-}Parameter;
+    const u8 *data;                             //Next byte to send
+    u32 len;                                    //Bytes left
+    const Web_Template_t *tpl;                  //Template being sent instead of data
+    u8  part;                                   //Current part of tpl
+    u16 offset;                                 //Bytes of that part already sent
+} Http_TxDesc_t;
+
+typedef struct Http_TxQueue                     //Transmit queue, sent as the TCP window allows
+{
+    Http_TxDesc_t desc[HTTP_TX_QUEUE_LEN];
+    u8  first;                                  //Index of the oldest piece
+    u8  count;                                  //Pieces in the queue
+    u8  close;                                  //Close the socket when done
+} Http_TxQueue_t;
+
+typedef struct Http_Session                     //State of one web server connection
+{
+    u8   used;                                  //Pool entry is taken
+    u8   socket;                                //Socket id of the connection
+    u32  lasttime;                              //LocalTime of the last received or sent data
+    Http_Parser_t parser;
+    Http_TxQueue_t tx;
+    u8   head[HTTP_HEAD_LEN];                   //Header of the current response, queued in tx
+} Http_Session_t;
 
 extern Basic_Cfg_t Basic_CfgBuf;
 
@@ -108,7 +150,9 @@ extern Login_Cfg_t Login_CfgBuf;
 
 extern Port_Cfg_t  Port_CfgBuf;
 
-extern st_http_request http_request;
+extern Http_Session_t http_sessions[HTTP_SESSIONS];
+
+extern char web_vars[WEB_VARS_COUNT][WEB_VAR_LEN];
 
 extern u8 Basic_Default[BASIC_CFG_LEN];
 
@@ -116,32 +160,43 @@ extern u8 Login_Default[LOGIN_CFG_LEN];
 
 extern u8 Port_Default[PORT_CFG_LEN];
 
-extern u8 httpweb[200] ;
+extern void Http_ParserInit(Http_Parser_t *parser);
 
-extern u8 HTTPDataBuffer[];
+extern u32 ParseHttpData(Http_Parser_t *parser, const u8 *buf, u32 len);
 
-extern u8 socket;
+u32 MakeAssetResponse(u8 *buf, const Web_Route_t *route, const Web_Asset_t *asset, u8 notmodified);
 
-extern void ParseHttpRequest(st_http_request *, char *);	
+u32 MakeTemplateResponse(u8 *buf, const Web_Route_t *route);
 
-extern void ParseURLType(char *, char *);
-
-void MakeHttpResponse(u8 *buf, char type, u32 len );
+u32 Web_TemplateLength(const Web_Template_t *tpl);
 
 extern char *GetURLName(char* url);
 
 extern char *DataLocate(char *buf,char *name);
 
-extern void copy_flash(const char *html, u32 len);
 
 extern void Init_Para_Tab(void) ;
 
-extern void Web_Server(void);
+extern void Web_Server(u8 id, st_http_request *request);
+
+extern void Web_SaveConfig(u8 id, st_http_request *request);
+
+extern void Web_Receive(u8 id);
+
+extern u8 Web_Send(u8 id, const u8 *data, u32 len);
+
+extern u8 Web_SendTemplate(u8 id, const Web_Template_t *tpl);
+
+extern u32 Web_TxPending(u8 id);
+
+extern u8 Web_SendPending(void);
+
+extern void Web_Close(u8 id);
 
-extern void WEB_ERASE(u32 Page_Address, u32 Length );
+extern Http_Session_t *Web_Session(u8 id);
 
-extern FLASH_Status WEB_WRITE( u32 StartAddr, u8 *Buffer, u32 Length );
+extern void Web_SocketOpened(u8 id);
 
-extern void WEB_READ( u32 StartAddr, u8 *Buffer, u32 Length );
+extern void Web_SocketClosed(u8 id);
 
 #endif	
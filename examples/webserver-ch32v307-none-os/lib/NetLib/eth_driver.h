@@ -150,7 +150,10 @@
 
 extern ETH_DMADESCTypeDef *DMATxDescToSet;
 extern ETH_DMADESCTypeDef *DMARxDescToGet;
+extern ETH_DMADESCTypeDef *pDMARxSet;                          //Next receive descriptor WCHNET reads
 extern SOCK_INF SocketInf[ ];
+extern uint32_t volatile LocalTime;
+extern uint8_t volatile NetEventPending;                        //Set by the network interrupts, the main loop does not sleep
 
 void ETH_PHYLink( void );
 void WCHNET_ETHIsr( void );
@@ -161,6 +164,7 @@ void ETH_LedLinkSet( uint8_t mode );
 void ETH_LedDataSet( uint8_t mode );
 void WCHNET_TimeIsr( uint16_t timperiod );
 void ETH_Configuration( uint8_t *macAddr );
+uint32_t ETH_TxPktChainMode( uint16_t len, uint32_t *pBuff );
 uint8_t ETH_LibInit( uint8_t *ip, uint8_t *gwip, uint8_t *mask, uint8_t *macaddr);
 
 #ifdef __cplusplus
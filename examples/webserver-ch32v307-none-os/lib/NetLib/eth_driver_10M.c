@@ -13,6 +13,9 @@
 #include "string.h"
 #include "eth_driver.h"
 
+/* One driver per MAC / PHY interface, ETH_DRIVER in net_config.h selects it */
+#if( ETH_DRIVER == ETH_DRIVER_10M )
+
 __attribute__((__aligned__(4))) ETH_DMADESCTypeDef DMARxDscrTab[ETH_RXBUFNB];       /* MAC receive descriptor, 4-byte aligned*/
 __attribute__((__aligned__(4))) ETH_DMADESCTypeDef DMATxDscrTab[ETH_TXBUFNB];       /* MAC send descriptor, 4-byte aligned */
 
@@ -832,51 +835,6 @@ void ETH_Configuration( uint8_t *macAddr )
                 ENABLE);
 }
 
-/*********************************************************************
- * @fn      ETH_TxPktChainMode
- *
- * @brief   Ethernet sends data frames in chain mode.
- *
- * @param   len     Send data length
- *          pBuff   send buffer pointer
- *
- * @return  Send status.
- */
-uint32_t ETH_TxPktChainMode(uint16_t len, uint32_t *pBuff )
-{
-    /* Check if the descriptor is owned by the ETHERNET DMA (when set) or CPU (when reset) */
-    if((DMATxDescToSet->Status & ETH_DMATxDesc_OWN) != (u32)RESET)
-    {
-        /* Return ERROR: OWN bit set */
-        return ETH_ERROR;
-    }
-    /* Setting the Frame Length: bits[12:0] */
-    DMATxDescToSet->ControlBufferSize = (len & ETH_DMATxDesc_TBS1);
-    DMATxDescToSet->Buffer1Addr = (uint32_t)pBuff;
-
-    /* Setting the last segment and first segment bits (in this case a frame is transmitted in one descriptor) */
-#if HARDWARE_CHECKSUM_CONFIG
-    DMATxDescToSet->Status |= ETH_DMATxDesc_LS | ETH_DMATxDesc_FS | ETH_DMATxDesc_CIC_TCPUDPICMP_Full;
-#else
-    DMATxDescToSet->Status |= ETH_DMATxDesc_LS | ETH_DMATxDesc_FS;
-#endif
-
-    /* Set Own bit of the Tx descriptor Status: gives the buffer back to ETHERNET DMA */
-    DMATxDescToSet->Status |= ETH_DMATxDesc_OWN;
-
-    /* Clear TBUS ETHERNET DMA flag */
-    ETH->DMASR = ETH_DMASR_TBUS;
-    /* Resume DMA transmission*/
-    ETH->DMATPDR = 0;
-
-    /* Update the ETHERNET DMA global Tx descriptor with next Tx descriptor */
-    /* Chained Mode */
-    /* Selects the next DMA Tx descriptor list for next buffer to send */
-    DMATxDescToSet = (ETH_DMADESCTypeDef*) (DMATxDescToSet->Buffer2NextDescAddr);
-    /* Return SUCCESS */
-    return ETH_SUCCESS;
-}
-
 /*********************************************************************
  * @fn      WCHNET_ETHIsr
  *
@@ -980,4 +938,6 @@ uint8_t ETH_LibInit( uint8_t *ip, uint8_t *gwip, uint8_t *mask, uint8_t *macaddr
     return (s);
 }
 
+#endif /* ETH_DRIVER == ETH_DRIVER_10M */
+
 /******************************** endfile @ eth_driver ******************************/
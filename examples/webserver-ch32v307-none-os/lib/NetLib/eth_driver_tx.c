@@ -0,0 +1,69 @@
+/*
+ * Send function of the Ethernet drivers, shared by all of them.
+ *
+ * Each send descriptor has its own ETH_TX_BUF_SZE buffer in MACTxBuf,
+ * linked by ETH_DMATxDescChainInit() in the driver. WCHNET asks for the
+ * buffer of the next descriptor (DMATxDescToSet->Buffer1Addr), builds the
+ * frame there and then calls net_send, so the buffer must stay attached
+ * to its descriptor. A frame from anywhere else is copied into it.
+ *
+ * When the descriptor is still owned by the DMA, ETH_ERROR is returned
+ * and nothing is queued. WCHNET then retries the frame
+ * (SOCKET_SEND_RETRY in net_config.h) instead of dropping it. More
+ * descriptors (ETH_TXBUFNB) keep more frames queued ahead of the DMA, at
+ * ETH_TX_BUF_SZE bytes of RAM each.
+ */
+#include <string.h>
+#include "eth_driver.h"
+
+/*********************************************************************
+ * @fn      ETH_TxPktChainMode
+ *
+ * @brief   Ethernet sends data frames in chain mode, the send function
+ *          of WCHNET.
+ *
+ * @param   len     Send data length
+ *          pBuff   send buffer pointer
+ *
+ * @return  Send status.
+ */
+uint32_t ETH_TxPktChainMode(uint16_t len, uint32_t *pBuff)
+{
+    /* Check if the descriptor is owned by the ETHERNET DMA (when set) or CPU (when reset) */
+    if((DMATxDescToSet->Status & ETH_DMATxDesc_OWN) != (u32)RESET || len > ETH_TX_BUF_SZE)
+    {
+        /* Return ERROR: OWN bit set */
+        return ETH_ERROR;
+    }
+    /* WCHNET built the frame in the buffer of the descriptor already */
+    if((uint32_t)pBuff != DMATxDescToSet->Buffer1Addr)
+    {
+        memcpy((void *)DMATxDescToSet->Buffer1Addr, pBuff, len);
+    }
+    /* Setting the Frame Length: bits[12:0] */
+    DMATxDescToSet->ControlBufferSize = (len & ETH_DMATxDesc_TBS1);
+
+    /* Setting the last segment and first segment bits (in this case a frame is transmitted in one descriptor) */
+#if HARDWARE_CHECKSUM_CONFIG
+    DMATxDescToSet->Status |= ETH_DMATxDesc_LS | ETH_DMATxDesc_FS | ETH_DMATxDesc_CIC_TCPUDPICMP_Full;
+#else
+    DMATxDescToSet->Status |= ETH_DMATxDesc_LS | ETH_DMATxDesc_FS;
+#endif
+
+    /* Set Own bit of the Tx descriptor Status: gives the buffer back to ETHERNET DMA */
+    DMATxDescToSet->Status |= ETH_DMATxDesc_OWN;
+
+    /* Clear TBUS ETHERNET DMA flag */
+    ETH->DMASR = ETH_DMASR_TBUS;
+    /* Resume DMA transmission*/
+    ETH->DMATPDR = 0;
+
+    /* Update the ETHERNET DMA global Tx descriptor with next Tx descriptor */
+    /* Chained Mode */
+    /* Selects the next DMA Tx descriptor list for next buffer to send */
+    DMATxDescToSet = (ETH_DMADESCTypeDef*) (DMATxDescToSet->Buffer2NextDescAddr);
+    /* Return SUCCESS */
+    return ETH_SUCCESS;
+}
+
+/******************************** endfile @ eth_driver_tx ******************************/
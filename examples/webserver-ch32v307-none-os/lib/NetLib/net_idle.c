@@ -0,0 +1,142 @@
+/*
+ * Sleep of the network main loop and its CPU load, see net_idle.h.
+ *
+ * The ETH, TIM2 and PHY link interrupt handlers are here as well, they
+ * replace the weak ones of the startup file. The application's
+ * ch32v30x_it.c only has its own handlers.
+ */
+#include "net_idle.h"
+
+void ETH_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+void TIM2_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+void EXTI9_5_IRQHandler(void) __attribute__((interrupt()));
+
+Net_Load_t NetLoad;
+u8 volatile NetEventPending = 1;
+
+/*********************************************************************
+ * @fn      TIM2_Init
+ *
+ * @brief   Initializes TIM2.
+ *
+ * @return  none
+ */
+void TIM2_Init(void)
+{
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure = { 0 };
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+
+    TIM_TimeBaseStructure.TIM_Period = WCHNETTIMERPERIOD * 1000 - 1;  //The counter runs at 1 MHz, see Net_Micros
+    TIM_TimeBaseStructure.TIM_Prescaler = SystemCoreClock / 1000000 - 1;
+    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
+    TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
+
+    TIM_Cmd(TIM2, ENABLE);
+    TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+    NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+/*********************************************************************
+ * @fn      Net_Micros
+ *
+ * @brief   Time since reset from LocalTime and the TIM2 counter.
+ *
+ * @return  microseconds, wraps after 71 minutes
+ */
+u32 Net_Micros(void)
+{
+    u32 ms, us;
+
+    do {
+        ms = LocalTime;
+        us = TIM2->CNT;
+    } while(ms != LocalTime);                                   //TIM2 interrupt in between
+    return ms * 1000 + us;
+}
+
+/*********************************************************************
+ * @fn      Net_Idle
+ *
+ * @brief   Sleep until the next interrupt if there is nothing to do.
+ *          NetEventPending is checked with interrupts disabled, WFI
+ *          still wakes up on a pending interrupt, so none is missed
+ *          between the check and WFI. The load of the last
+ *          NET_LOAD_PERIOD is updated on every call.
+ *
+ * @return  none
+ */
+void Net_Idle(void)
+{
+    u32 start;
+
+    /*On every pass, also when the loop does not sleep,
+     * so a busy loop shows 0% idle and not the last value*/
+    if(LocalTime - NetLoad.start >= NET_LOAD_PERIOD)
+    {
+        NetLoad.period_wakeups = NetLoad.wakeups - NetLoad.start_wakeups;
+        NetLoad.idle_pct = (NetLoad.idle_us - NetLoad.start_idle_us) / ((LocalTime - NetLoad.start) * 10);
+        NetLoad.start = LocalTime;
+        NetLoad.start_wakeups = NetLoad.wakeups;
+        NetLoad.start_idle_us = NetLoad.idle_us;
+#if NET_LOAD_REPORT
+        printf("idle %d%%, %d wake-ups\r\n", NetLoad.idle_pct, NetLoad.period_wakeups);
+#endif
+    }
+
+    start = Net_Micros();
+    __disable_irq();
+    if(NetEventPending ||
+       (pDMARxSet->Status & ETH_DMARxDesc_OWN) == (u32)RESET)   //Frames that were not read yet
+    {
+        __enable_irq();
+        return;
+    }
+    __WFI();
+    __enable_irq();                                             //The interrupt that woke the core runs here
+    NetLoad.wakeups++;
+    NetLoad.idle_us += Net_Micros() - start;
+}
+
+/*********************************************************************
+ * @fn      EXTI9_5_IRQHandler
+ *
+ * @brief   This function handles GPIO exception.
+ *
+ * @return  none
+ */
+void EXTI9_5_IRQHandler(void)
+{
+    ETH_PHYLink( );
+    NetEventPending = 1;
+    EXTI_ClearITPendingBit(EXTI_Line7);     /* Clear Flag */
+}
+
+/*********************************************************************
+ * @fn      ETH_IRQHandler
+ *
+ * @brief   This function handles ETH exception.
+ *
+ * @return  none
+ */
+void ETH_IRQHandler(void)
+{
+    WCHNET_ETHIsr();
+    NetEventPending = 1;                    /* Frame received or sent, run the main loop */
+}
+
+/*********************************************************************
+ * @fn      TIM2_IRQHandler
+ *
+ * @brief   This function handles TIM2 exception.
+ *
+ * @return  none
+ */
+void TIM2_IRQHandler(void)
+{
+    WCHNET_TimeIsr(WCHNETTIMERPERIOD);
+    NetEventPending = 1;                    /* WCHNET timers and retries are due */
+    TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+}
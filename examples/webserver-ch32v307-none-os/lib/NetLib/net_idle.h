@@ -0,0 +1,50 @@
+/*
+ * Sleep of the network main loop and its CPU load, shared by the examples.
+ *
+ * The main loop clears NetEventPending, runs WCHNET and calls Net_Idle(),
+ * which sleeps in WFI until the next interrupt. The ETH, TIM2 and PHY link
+ * interrupts (net_idle.c) set NetEventPending, as should every other
+ * interrupt the application waits for.
+ *
+ * NetLoad counts the wake-ups and the time asleep; read it with the
+ * debugger, or build with -D NET_LOAD_REPORT=1 to print it every
+ * NET_LOAD_PERIOD ms.
+ */
+#ifndef __NET_IDLE_H__
+#define __NET_IDLE_H__
+
+#include "eth_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef NET_LOAD_PERIOD
+#define NET_LOAD_PERIOD     1000
+#endif
+#ifndef NET_LOAD_REPORT
+#define NET_LOAD_REPORT     0
+#endif
+
+typedef struct Net_Load
+{
+    u32 wakeups;                                                //Wake-ups from WFI since reset
+    u32 idle_us;                                                //Time asleep since reset, wraps after 71 minutes
+    u32 period_wakeups;                                         //Wake-ups in the last period
+    u8  idle_pct;                                               //Time asleep in the last period, percent
+    u32 start;                                                  //LocalTime at the start of the current period
+    u32 start_wakeups;
+    u32 start_idle_us;
+} Net_Load_t;
+
+extern Net_Load_t NetLoad;
+
+void TIM2_Init(void);
+u32 Net_Micros(void);
+void Net_Idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
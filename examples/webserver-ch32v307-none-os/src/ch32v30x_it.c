@@ -12,11 +12,9 @@
 #include "eth_driver.h"
 #include "ch32v30x_it.h"
 
+/* The ETH, TIM2 and PHY link (EXTI9_5) handlers are in lib/NetLib/net_idle.c */
 void NMI_Handler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
 void HardFault_Handler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
-void ETH_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
-void TIM2_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
-void EXTI9_5_IRQHandler(void) __attribute__((interrupt()));
 /*********************************************************************
  * @fn      NMI_Handler
  *
@@ -45,40 +43,3 @@ void HardFault_Handler(void)
     while(1);
 }
 
-/*********************************************************************
- * @fn      EXTI9_5_IRQHandler
- *
- * @brief   This function handles GPIO exception.
- *
- * @return  none
- */
-void EXTI9_5_IRQHandler(void)
-{
-    ETH_PHYLink( );
-    EXTI_ClearITPendingBit(EXTI_Line7);     /* Clear Flag */
-}
-
-/*********************************************************************
- * @fn      ETH_IRQHandler
- *
- * @brief   This function handles ETH exception.
- *
- * @return  none
- */
-void ETH_IRQHandler(void)
-{
-    WCHNET_ETHIsr();
-}
-
-/*********************************************************************
- * @fn      TIM2_IRQHandler
- *
- * @brief   This function handles TIM2 exception.
- *
- * @return  none
- */
-void TIM2_IRQHandler(void)
-{
-    WCHNET_TimeIsr(WCHNETTIMERPERIOD);
-    TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
-}
@@ -19,6 +19,7 @@ please refer to the "CH32V30x Evaluation Board Manual" under the CH32V307EVT\EVT
  */
 #include "string.h"
 #include "eth_driver.h"
+#include "net_idle.h"
 #include "HTTPS.h"
 
 u8 MACAddr[6];                                                  //MAC address
@@ -27,9 +28,10 @@ u8 GWIPAddr[4];                                                 //Gateway IP add
 u8 IPMask[4];                                                   //subnet mask
 
 u8 SocketId, SocketIdForListen;
-u8 RecvBuffer[RECE_BUF_LEN], HTTPDataBuffer[RECE_BUF_LEN];
+u8 RecvBuffer[RECE_BUF_LEN];
 u8 SocketRecvBuf[WCHNET_MAX_SOCKET_NUM][RECE_BUF_LEN];          //socket receive buffer
 u16 DESPORT, SRCPORT;                                           //port
+
 /*********************************************************************
  * @fn      mStopIfError
  *
@@ -46,31 +48,6 @@ void mStopIfError(u8 iError)
     printf("Error: %02X\r\n", (u16) iError);
 }
 
-/*********************************************************************
- * @fn      TIM2_Init
- *
- * @brief   Initializes TIM2.
- *
- * @return  none
- */
-void TIM2_Init(void)
-{
-    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure = { 0 };
-
-    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
-
-    TIM_TimeBaseStructure.TIM_Period = SystemCoreClock / 1000000;
-    TIM_TimeBaseStructure.TIM_Prescaler = WCHNETTIMERPERIOD * 1000 - 1;
-    TIM_TimeBaseStructure.TIM_ClockDivision = 0;
-    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
-    TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
-    TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
-
-    TIM_Cmd(TIM2, ENABLE);
-    TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
-    NVIC_EnableIRQ(TIM2_IRQn);
-}
-
 /*********************************************************************
  * @fn      WCHNET_CreateTcpSocketListen
  *
@@ -150,10 +127,9 @@ void WCHNET_CreateCfgSocket(u8 mode, u8 *Desip, u16 Desport, u16 Srcport)
  */
 void WCHNET_RestoreDefaults(void)                                       /*WCHNET restore default settings*/
 {
-    WEB_ERASE( PAGE_WRITE_START_ADDR, FLASH_PAGE_SIZE * 3);
-    WEB_WRITE( BASIC_CFG_ADDR, Basic_Default, BASIC_CFG_LEN);
-    WEB_WRITE( PORT_CFG_ADDR, Port_Default, PORT_CFG_LEN);
-    WEB_WRITE( LOGIN_CFG_ADDR, Login_Default, LOGIN_CFG_LEN);
+    Cfg_Write(CFG_KEY_BASIC, Basic_Default, BASIC_CFG_LEN);
+    Cfg_Write(CFG_KEY_PORT, Port_Default, PORT_CFG_LEN);
+    Cfg_Write(CFG_KEY_LOGIN, Login_Default, LOGIN_CFG_LEN);
     NVIC_SystemReset();
 }
 
@@ -174,11 +150,8 @@ void WCHNET_HandleSockInt(u8 socketid, u8 intstat)
     if (intstat & SINT_STAT_RECV)                                   //receive data
     {
         len = WCHNET_SocketRecvLen(socketid, NULL);
-        if (SocketInf[socketid].SourPort == HTTP_SERVER_PORT) {     // receive HTTP data
-            socket = socketid;
-            WCHNET_SocketRecv(socketid, HTTPDataBuffer, &len);
-            Web_Server();
-        }
+        if (SocketInf[socketid].SourPort == HTTP_SERVER_PORT)       // receive HTTP data, parsed in the receive buffer
+            Web_Receive(socketid);
         else                                                        //receive the data of the configured socket
             WCHNET_SocketRecv(socketid, RecvBuffer, &len);
         printf("socketid:%d Received data length:%d\r\n",socketid, len);
@@ -186,14 +159,18 @@ void WCHNET_HandleSockInt(u8 socketid, u8 intstat)
     if (intstat & SINT_STAT_CONNECT)                                //connect successfully
     {
         WCHNET_ModifyRecvBuf(socketid, (u32)SocketRecvBuf[socketid], RECE_BUF_LEN);
+        if (SocketInf[socketid].SourPort == HTTP_SERVER_PORT)       //each browser connection gets its own session
+            Web_SocketOpened(socketid);
         printf("TCP Connect Success\r\n");
     }
     if (intstat & SINT_STAT_DISCONNECT)                             //disconnect
     {
+        Web_SocketClosed(socketid);
         printf("TCP Disconnect\r\n");
     }
     if (intstat & SINT_STAT_TIM_OUT)                                //timeout disconnect
     {
+        Web_SocketClosed(socketid);
         printf("TCP Timeout\r\n");
         WCHNET_CreateCfgSocket(Port_CfgBuf.mode, Port_CfgBuf.des_ip, DESPORT, SRCPORT);
     }
@@ -318,6 +295,7 @@ int main(void)
     if (WCHNET_LIB_VER != WCHNET_GetVer()) {
         printf("version error.\n");
     }
+    Cfg_Init();                                                                 //Index of the configuration records
     /*After the button(PB6) is pressed, initialize
      * WCHNET and execute the default configuration*/
     if (GPIO_ReadInputDataBit(GPIOB, GPIO_Pin_6) == 0) {
@@ -327,21 +305,13 @@ int main(void)
             WCHNET_RestoreDefaults();
         }
     }
-    WEB_READ( BASIC_CFG_ADDR, (u8 *)&Basic_CfgBuf, BASIC_CFG_LEN );                //Read configuration information
-    WEB_READ( PORT_CFG_ADDR, (u8 *)&Port_CfgBuf, PORT_CFG_LEN );
-    WEB_READ( LOGIN_CFG_ADDR, (u8 *)&Login_CfgBuf, LOGIN_CFG_LEN );
-    if((Basic_CfgBuf.flag[0] != 0x57) || (Basic_CfgBuf.flag[1] != 0xAB)){       //Determine network configuration information flags
+    /*Read configuration information, the records are checked by CRC.
+     * Only restore the defaults if one was never stored*/
+    if((Cfg_Read(CFG_KEY_BASIC, (u8 *)&Basic_CfgBuf, BASIC_CFG_LEN) != BASIC_CFG_LEN) ||
+       (Cfg_Read(CFG_KEY_PORT, (u8 *)&Port_CfgBuf, PORT_CFG_LEN) != PORT_CFG_LEN) ||
+       (Cfg_Read(CFG_KEY_LOGIN, (u8 *)&Login_CfgBuf, LOGIN_CFG_LEN) != LOGIN_CFG_LEN)){
         WCHNET_RestoreDefaults();
     }
-    else {
-        if((Port_CfgBuf.flag[0] != 0x57) || (Port_CfgBuf.flag[1] != 0xAB)){     //Determine password configuration information
-            WCHNET_RestoreDefaults();
-        }
-        else {
-            if((Login_CfgBuf.flag[0] != 0x57) || (Login_CfgBuf.flag[1] != 0xAB)) //Determine password configuration information
-                WCHNET_RestoreDefaults();
-        }
-    }
    //memcpy(MACAddr, Basic_CfgBuf.mac, 6);
     WCHNET_GetMacAddr(MACAddr);                                           //get the chip MAC address
     memcpy(IPAddr, Basic_CfgBuf.ip, 4);
@@ -375,15 +345,26 @@ int main(void)
 
     while(1)
     {
+        NetEventPending = 0;
         /*Ethernet library main task function,
-         * which needs to be called cyclically*/
+         * which needs to be called after every network interrupt*/
         WCHNET_MainTask();
         /*Query the Ethernet global interrupt,
          * if there is an interrupt, call the global interrupt handler*/
         if(WCHNET_QueryGlobalInt())
         {
             WCHNET_HandleGlobalInt();
+            NetEventPending = 1;                                //Let WCHNET send the replies before sleeping
+        }
+        /*Continue the web page bodies that did not fit into the send window,
+         * then the requests that were pipelined behind them, and close
+         * idle web connections*/
+        if(Web_SendPending())
+        {
+            NetEventPending = 1;
         }
+        /*Sleep until the next frame, timer tick or link change*/
+        Net_Idle();
     }
 }
 
@@ -0,0 +1,141 @@
+/*
+ * Host tests of the configuration store in lib/Config, run with
+ * "pio test -e native".
+ */
+#include <string.h>
+#include <unity.h>
+#include "cfg_store.h"
+#include "host_shim.h"
+
+#define PAGE(n) ((u8 *)(uintptr_t)(CFG_STORE_ADDR + (n) * CFG_PAGE_SIZE))
+
+/* the host shim does not emulate the flash controller */
+static int erases[CFG_STORE_PAGES];
+
+void Cfg_FlashErase(u32 addr)
+{
+    erases[(addr - CFG_STORE_ADDR) / CFG_PAGE_SIZE]++;
+    memset((void *)(uintptr_t)addr, 0xFF, CFG_PAGE_SIZE);
+}
+
+static u32 read_u32(u8 key)
+{
+    u32 value = 0;
+
+    TEST_ASSERT_EQUAL(sizeof(value), Cfg_Read(key, (u8 *)&value, sizeof(value)));
+    return value;
+}
+
+static void write_u32(u8 key, u32 value)
+{
+    TEST_ASSERT_EQUAL(READY, Cfg_Write(key, (const u8 *)&value, sizeof(value)));
+}
+
+void setUp(void)
+{
+    host_shim_reset();
+    memset(erases, 0, sizeof(erases));
+    Cfg_Init();
+}
+
+void tearDown(void)
+{
+}
+
+static void test_empty_store(void)
+{
+    u8 buf[4];
+
+    TEST_ASSERT_EQUAL(0, Cfg_Read(CFG_KEY_BASIC, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(NoREADY, Cfg_Write(CFG_KEYS_MAX, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL(NoREADY, Cfg_Write(CFG_KEY_BASIC, buf, CFG_DATA_LEN + 1));
+}
+
+static void test_values_survive_reboot(void)
+{
+    write_u32(CFG_KEY_BASIC, 1);
+    write_u32(CFG_KEY_PORT, 2);
+    write_u32(CFG_KEY_BASIC, 3);
+    Cfg_Init();
+    TEST_ASSERT_EQUAL(3, read_u32(CFG_KEY_BASIC));
+    TEST_ASSERT_EQUAL(2, read_u32(CFG_KEY_PORT));
+    TEST_ASSERT_EQUAL(0, Cfg_Read(CFG_KEY_LOGIN, NULL, 0));
+}
+
+static void test_unchanged_value_not_written(void)
+{
+    int i;
+
+    for(i = 0; i < 100; i++)
+        write_u32(CFG_KEY_LOGIN, 7);
+    TEST_ASSERT_EQUAL(1, erases[0]);
+    TEST_ASSERT_EQUAL(0, erases[1]);
+}
+
+static void test_erases_spread_over_all_pages(void)
+{
+    u32 i;
+    int page, min = 1000, max = 0;
+
+    write_u32(CFG_KEY_PORT, 1000);
+    for(i = 0; i < 200; i++)
+        write_u32(CFG_KEY_BASIC, i);
+    for(page = 0; page < CFG_STORE_PAGES; page++)
+    {
+        min = erases[page] < min ? erases[page] : min;
+        max = erases[page] > max ? erases[page] : max;
+    }
+    TEST_ASSERT_TRUE(min > 0);
+    TEST_ASSERT_TRUE(max - min <= 1);
+    Cfg_Init();
+    TEST_ASSERT_EQUAL(199, read_u32(CFG_KEY_BASIC));
+    TEST_ASSERT_EQUAL(1000, read_u32(CFG_KEY_PORT));
+}
+
+static void test_cut_off_record_ignored(void)
+{
+    Cfg_Record_t *rec = (Cfg_Record_t *)(PAGE(0) + 2 * CFG_SLOT_SIZE);
+
+    write_u32(CFG_KEY_BASIC, 1);
+    write_u32(CFG_KEY_BASIC, 2);
+    /* power lost before the CRC of the second record was programmed */
+    rec->crc = 0xFFFFFFFF;
+    Cfg_Init();
+    TEST_ASSERT_EQUAL(1, read_u32(CFG_KEY_BASIC));
+    /* the slot stays used, the next record goes behind it */
+    write_u32(CFG_KEY_BASIC, 3);
+    Cfg_Init();
+    TEST_ASSERT_EQUAL(3, read_u32(CFG_KEY_BASIC));
+}
+
+static void test_interrupted_page_change_completed(void)
+{
+    Cfg_PageHead_t head = {CFG_PAGE_MAGIC, 2, 0};
+
+    write_u32(CFG_KEY_BASIC, 1);
+    write_u32(CFG_KEY_PORT, 2);
+    /* power lost after the next page got its header, before the copies */
+    head.crc = Cfg_Crc32((const u8 *)&head, 8);
+    memset(PAGE(1), 0xFF, CFG_PAGE_SIZE);
+    memcpy(PAGE(1), &head, sizeof(head));
+    Cfg_Init();
+    TEST_ASSERT_EQUAL(1, read_u32(CFG_KEY_BASIC));
+    TEST_ASSERT_EQUAL(2, read_u32(CFG_KEY_PORT));
+    /* both were copied to the new page, the old one is not needed */
+    memset(PAGE(0), 0xFF, CFG_PAGE_SIZE);
+    Cfg_Init();
+    TEST_ASSERT_EQUAL(1, read_u32(CFG_KEY_BASIC));
+    TEST_ASSERT_EQUAL(2, read_u32(CFG_KEY_PORT));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_store);
+    RUN_TEST(test_values_survive_reboot);
+    RUN_TEST(test_unchanged_value_not_written);
+    RUN_TEST(test_erases_spread_over_all_pages);
+    RUN_TEST(test_cut_off_record_ignored);
+    RUN_TEST(test_interrupted_page_change_completed);
+    return UNITY_END();
+}
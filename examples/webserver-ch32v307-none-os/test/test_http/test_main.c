@@ -0,0 +1,610 @@
+/*
+ * Host tests of the request parsing and page generation in lib/HTTP,
+ * run with "pio test -e native".
+ */
+#include <string.h>
+#include <unity.h>
+#include "HTTPS.h"
+#include "host_shim.h"
+
+/* from the ethernet driver in lib/NetLib */
+SOCK_INF SocketInf[WCHNET_MAX_SOCKET_NUM];
+uint32_t volatile LocalTime;
+
+/* not declared in HTTPS.h */
+uint8_t URLDecode(char *srcptr, char *desptr, uint8_t bufflen);
+void Refresh_Basic(u8 *buf);
+
+/* WCHNET stubs, the library is only available for RISC-V. Sent data is
+ * collected in sent[], send_window limits how much the socket accepts. */
+static u8 sent[16384];
+static u32 sent_len;
+static u32 sent_to[WCHNET_MAX_SOCKET_NUM];
+static u32 send_window;
+static int send_calls;
+static int socket_closed;
+
+uint8_t WCHNET_SocketSend(uint8_t socketid, uint8_t *buf, uint32_t *len)
+{
+    send_calls++;
+    if(*len > send_window)
+        *len = send_window;
+    if(sent_len + *len <= sizeof(sent))
+        memcpy(&sent[sent_len], buf, *len);
+    sent_len += *len;
+    sent_to[socketid] += *len;
+    send_window -= *len;
+    return WCHNET_ERR_SUCCESS;
+}
+
+uint8_t WCHNET_SocketClose(uint8_t socketid, uint8_t mode)
+{
+    (void)socketid;
+    (void)mode;
+    socket_closed = 1;
+    return WCHNET_ERR_SUCCESS;
+}
+
+/* The receive buffers are small rings, so that requests wrap around their
+ * end. receive_on() puts data into one like WCHNET does and lets the web
+ * server parse it, receive() does so for socket 1. */
+static u8 ring[WCHNET_MAX_SOCKET_NUM][64];
+
+uint32_t WCHNET_SocketRecvLen(uint8_t socketid, uint32_t *bufaddr)
+{
+    if(bufaddr != NULL)
+        *bufaddr = SocketInf[socketid].RecvReadPoint;
+    return SocketInf[socketid].RecvRemLen;
+}
+
+uint8_t WCHNET_SocketRecv(uint8_t socketid, uint8_t *buf, uint32_t *len)
+{
+    SOCK_INF *inf = &SocketInf[socketid];
+    uint32_t i;
+
+    if(*len > inf->RecvRemLen)
+        *len = inf->RecvRemLen;
+    for(i = 0; i < *len; i++)
+    {
+        if(buf != NULL)
+            buf[i] = *(u8 *)(uintptr_t)inf->RecvReadPoint;
+        if(++inf->RecvReadPoint == inf->RecvStartPoint + inf->RecvBufLen)
+            inf->RecvReadPoint = inf->RecvStartPoint;
+    }
+    inf->RecvRemLen -= *len;
+    return WCHNET_ERR_SUCCESS;
+}
+
+static void receive_on(u8 id, const char *data)
+{
+    SOCK_INF *inf = &SocketInf[id];
+    uint32_t len = strlen(data), pos, i;
+
+    TEST_ASSERT_TRUE(inf->RecvRemLen + len <= sizeof(ring[id]));
+    pos = inf->RecvReadPoint - inf->RecvStartPoint + inf->RecvRemLen;
+    for(i = 0; i < len; i++)
+        ring[id][(pos + i) % sizeof(ring[id])] = data[i];
+    inf->RecvRemLen += len;
+    Web_Receive(id);
+}
+
+static void receive(const char *data)
+{
+    receive_on(1, data);
+}
+
+/* parse a complete request at once */
+static Http_Parser_t parser;
+
+static st_http_request *parse(const char *req)
+{
+    Http_ParserInit(&parser);
+    TEST_ASSERT_EQUAL(strlen(req), ParseHttpData(&parser, (const u8 *)req, strlen(req)));
+    TEST_ASSERT_EQUAL(HTTP_STATE_DONE, parser.state);
+    return &parser.request;
+}
+
+/* number of times str was sent, the bodies may contain zeros */
+static int count(const char *str)
+{
+    u32 i, len = strlen(str);
+    int n = 0;
+
+    for(i = 0; i + len <= sent_len && i + len <= sizeof(sent); i++)
+        n += memcmp(&sent[i], str, len) == 0;
+    return n;
+}
+
+void setUp(void)
+{
+    u8 id;
+
+    host_shim_reset();
+    Cfg_Init();
+    memset(SocketInf, 0, sizeof(SocketInf));
+    for(id = 0; id < WCHNET_MAX_SOCKET_NUM; id++)
+    {
+        Web_SocketClosed(id);
+        SocketInf[id].RecvStartPoint = (uint32_t)(uintptr_t)ring[id];
+        SocketInf[id].RecvBufLen = sizeof(ring[id]);
+        SocketInf[id].RecvReadPoint = SocketInf[id].RecvStartPoint;
+    }
+    LocalTime = 0;
+    Web_SocketOpened(1);
+    sent_len = 0;
+    memset(sent_to, 0, sizeof(sent_to));
+    send_window = UINT32_MAX;
+    send_calls = 0;
+    socket_closed = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static void test_parse_get_request(void)
+{
+    st_http_request *req = parse("GET /main.html?x=1 HTTP/1.1\r\nHost: 192.168.1.10\r\n"
+                                 "If-None-Match: \"abc\"\r\n\r\n");
+
+    TEST_ASSERT_EQUAL(METHOD_GET, req->METHOD);
+    TEST_ASSERT_EQUAL_STRING("main.html", req->URL);
+    TEST_ASSERT_EQUAL_STRING("\"abc\"", req->ETAG);
+    TEST_ASSERT_TRUE(req->KEEPALIVE);
+}
+
+static void test_parse_post_request(void)
+{
+    st_http_request *req = parse("POST /login.html HTTP/1.1\r\ncontent-length: 9\r\n\r\n__PUSE=a&");
+
+    TEST_ASSERT_EQUAL(METHOD_POST, req->METHOD);
+    TEST_ASSERT_EQUAL_STRING("login.html", req->URL);
+    TEST_ASSERT_EQUAL(9, req->BODYLEN);
+    TEST_ASSERT_EQUAL_STRING("__PUSE=a&", req->BODY);
+}
+
+static void test_parse_unknown_method(void)
+{
+    TEST_ASSERT_EQUAL(METHOD_ERR, parse("PUT /main.html HTTP/1.1\r\n\r\n")->METHOD);
+}
+
+static void test_parse_connection_close(void)
+{
+    TEST_ASSERT_FALSE(parse("GET / HTTP/1.0\r\n\r\n")->KEEPALIVE);
+    TEST_ASSERT_FALSE(parse("GET / HTTP/1.1\r\nConnection: close\r\n\r\n")->KEEPALIVE);
+    TEST_ASSERT_TRUE(parse("GET / HTTP/1.0\r\nConnection: keep-alive\r\n\r\n")->KEEPALIVE);
+}
+
+static void test_parse_byte_by_byte(void)
+{
+    const char *req = "POST /success.html HTTP/1.1\r\nUser-Agent: a header line that is longer "
+                      "than the line buffer of the parser\r\nContent-Length: 4\r\n\r\nabcdGET";
+    u32 i;
+
+    Http_ParserInit(&parser);
+    for(i = 0; parser.state != HTTP_STATE_DONE; i++)
+        TEST_ASSERT_EQUAL(1, ParseHttpData(&parser, (const u8 *)&req[i], 1));
+    /* stops at the end of the request, "GET" belongs to the next one */
+    TEST_ASSERT_EQUAL_STRING("GET", &req[i]);
+    TEST_ASSERT_EQUAL(0, ParseHttpData(&parser, (const u8 *)&req[i], 3));
+    TEST_ASSERT_EQUAL_STRING("success.html", parser.request.URL);
+    TEST_ASSERT_EQUAL_STRING("abcd", parser.request.BODY);
+}
+
+static void test_url_decode(void)
+{
+    char src[] = "a%41%2fb";
+    char dst[16] = {0};
+
+    TEST_ASSERT_EQUAL(4, URLDecode(src, dst, strlen(src)));
+    TEST_ASSERT_EQUAL_MEMORY("aA/b", dst, 4);
+}
+
+static void test_url_decode_rejects_bad_input(void)
+{
+    char bad_hex[] = "a%zz";
+    char too_long[] = "0123456789abc";
+    char dst[16];
+
+    TEST_ASSERT_EQUAL(NoREADY, URLDecode(bad_hex, dst, strlen(bad_hex)));
+    TEST_ASSERT_EQUAL(NoREADY, URLDecode(too_long, dst, strlen(too_long)));
+}
+
+static void test_refresh_basic_stores_config(void)
+{
+    u8 post[] = "__PMAC=1.2.3.4.5.6&__PSIP=192.168.1.10&__PMSK=255.255.255.0&__PGAT=192.168.1.1\r\n";
+    Basic_Cfg_t cfg;
+
+    Refresh_Basic(post);
+    TEST_ASSERT_EQUAL(BASIC_CFG_LEN, Cfg_Read(CFG_KEY_BASIC, (u8 *)&cfg, BASIC_CFG_LEN));
+    TEST_ASSERT_EQUAL_HEX8(0x57, cfg.flag[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xAB, cfg.flag[1]);
+    TEST_ASSERT_EQUAL_MEMORY(((u8[]){1, 2, 3, 4, 5, 6}), cfg.mac, 6);
+    TEST_ASSERT_EQUAL_MEMORY(((u8[]){192, 168, 1, 10}), cfg.ip, 4);
+    TEST_ASSERT_EQUAL_MEMORY(((u8[]){255, 255, 255, 0}), cfg.mask, 4);
+    TEST_ASSERT_EQUAL_MEMORY(((u8[]){192, 168, 1, 1}), cfg.gateway, 4);
+}
+
+static void test_static_asset_streamed_from_flash(void)
+{
+    const char *body;
+    int rounds = 0;
+
+    send_window = 1000;
+    receive("GET /logo.png HTTP/1.1\r\nConnection: close\r\n\r\n");
+    /* the socket stays open until the body is sent */
+    TEST_ASSERT_FALSE(socket_closed);
+    while(!socket_closed && rounds < 100)
+    {
+        send_window = 300;
+        Web_SendPending();
+        rounds++;
+    }
+    TEST_ASSERT_TRUE(socket_closed);
+    TEST_ASSERT_TRUE(rounds > 1);
+    body = strstr((char *)sent, "\r\n\r\n") + 4;
+    TEST_ASSERT_EQUAL(atoi(strstr((char *)sent, "Content-Length:") + 15), sent_len - (body - (char *)sent));
+    TEST_ASSERT_EQUAL_MEMORY(Web_FindRoute(METHOD_GET, "logo.png")->asset->data, body, sent_len - (body - (char *)sent));
+}
+
+static void test_asset_gzip_and_etag_headers(void)
+{
+    const Web_Asset_t *asset = Web_FindRoute(METHOD_GET, "main.html")->asset;
+    char etag[32];
+
+    TEST_ASSERT_NOT_NULL(asset);
+    TEST_ASSERT_TRUE(asset->gzip);
+    receive("GET /main.html HTTP/1.1\r\nAccept-Encoding: gzip, deflate, br\r\n\r\n");
+    TEST_ASSERT_EQUAL(1, count("Content-Encoding: gzip\r\n"));
+    TEST_ASSERT_EQUAL(1, count("Vary: Accept-Encoding\r\n"));
+    snprintf(etag, sizeof(etag), "ETag: %s\r\n", asset->etag);
+    TEST_ASSERT_EQUAL(1, count(etag));
+    TEST_ASSERT_EQUAL(1, count("Content-Type: text/html\r\n"));
+}
+
+static void test_asset_identity_without_gzip(void)
+{
+    const Web_Asset_t *asset = Web_FindRoute(METHOD_GET, "style.css")->asset;
+    const Web_Asset_t *identity = asset->identity;
+    char etag[32];
+
+    TEST_ASSERT_NOT_NULL(identity);
+    TEST_ASSERT_FALSE(identity->gzip);
+    TEST_ASSERT_TRUE(identity->len > asset->len);
+    TEST_ASSERT_NOT_EQUAL(0, strcmp(asset->etag, identity->etag));
+    receive("GET /style.css HTTP/1.1\r\n\r\n");
+    TEST_ASSERT_EQUAL(0, count("Content-Encoding:"));
+    TEST_ASSERT_EQUAL(1, count("Vary: Accept-Encoding\r\n"));
+    snprintf(etag, sizeof(etag), "ETag: %s\r\n", identity->etag);
+    TEST_ASSERT_EQUAL(1, count(etag));
+    TEST_ASSERT_EQUAL(identity->len, atoi(strstr((char *)sent, "Content-Length:") + 15));
+    TEST_ASSERT_EQUAL_MEMORY(identity->data, strstr((char *)sent, "\r\n\r\n") + 4, identity->len);
+}
+
+static void test_accept_encoding_parsed(void)
+{
+    TEST_ASSERT_FALSE(parse("GET / HTTP/1.1\r\n\r\n")->GZIP);
+    TEST_ASSERT_TRUE(parse("GET / HTTP/1.1\r\naccept-encoding: deflate, GZIP\r\n\r\n")->GZIP);
+    TEST_ASSERT_TRUE(parse("GET / HTTP/1.1\r\nAccept-Encoding: gzip;q=0.5\r\n\r\n")->GZIP);
+    TEST_ASSERT_FALSE(parse("GET / HTTP/1.1\r\nAccept-Encoding: gzip;q=0, *\r\n\r\n")->GZIP);
+    TEST_ASSERT_FALSE(parse("GET / HTTP/1.1\r\nAccept-Encoding: identity, x-gzip\r\n\r\n")->GZIP);
+    TEST_ASSERT_TRUE(parse("GET / HTTP/1.1\r\nAccept-Encoding: br;q=1.0, *;q=0.1\r\n\r\n")->GZIP);
+    TEST_ASSERT_FALSE(parse("GET / HTTP/1.1\r\nAccept-Encoding: *;q=0.0\r\n\r\n")->GZIP);
+}
+
+static void test_asset_not_modified(void)
+{
+    /* no Accept-Encoding, the client has the uncompressed copy */
+    const Web_Asset_t *asset = Web_FindRoute(METHOD_GET, "style.css")->asset->identity;
+    char req[64];
+    char expected[96];
+
+    snprintf(req, sizeof(req), "GET /style.css HTTP/1.1\r\nIf-None-Match: %s\r\n\r\n", asset->etag);
+    receive(req);
+    snprintf(expected, sizeof(expected), "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: %s\r\n\r\n", asset->etag);
+    TEST_ASSERT_EQUAL(strlen(expected), sent_len);
+    TEST_ASSERT_EQUAL_MEMORY(expected, sent, sent_len);
+}
+
+static void test_unknown_url_not_found(void)
+{
+    receive("GET /missing.html HTTP/1.1\r\n\r\n");
+    TEST_ASSERT_EQUAL(strlen(RES_NOT_FOUND), sent_len);
+    TEST_ASSERT_EQUAL_MEMORY(RES_NOT_FOUND, sent, strlen(RES_NOT_FOUND));
+}
+
+static void test_route_matches_whole_path(void)
+{
+    TEST_ASSERT_NULL(Web_FindRoute(METHOD_GET, "logo"));
+    TEST_ASSERT_NULL(Web_FindRoute(METHOD_GET, "logo.pngx"));
+    TEST_ASSERT_NULL(Web_FindRoute(METHOD_POST, "logo.png"));
+    TEST_ASSERT_EQUAL_PTR(Web_FindRoute(METHOD_GET, "login.html")->tpl, Web_FindRoute(METHOD_GET, "")->tpl);
+}
+
+static void test_head_sends_header_only(void)
+{
+    const Web_Asset_t *asset = Web_FindRoute(METHOD_GET, "logo.png")->asset;
+
+    receive("HEAD /logo.png HTTP/1.1\r\n\r\n");
+    sent[sent_len] = 0;
+    TEST_ASSERT_EQUAL(asset->len, atoi(strstr((char *)sent, "Content-Length:") + 15));
+    TEST_ASSERT_EQUAL(sent_len, strstr((char *)sent, "\r\n\r\n") + 4 - (char *)sent);
+}
+
+static void test_post_route_calls_handler(void)
+{
+    Basic_Cfg_t cfg;
+
+    receive("POST /success.html HTTP/1.1\r\nContent-Length: 80\r\n\r\n");
+    receive("__PMAC=1.2.3.4.5.6&__PSIP=192.168.1.20&");
+    receive("__PMSK=255.255.255.0&__PGAT=192.168.1.1\r\n");
+    TEST_ASSERT_EQUAL(1, count("HTTP/1.1 200 OK\r\n"));
+    TEST_ASSERT_EQUAL(BASIC_CFG_LEN, Cfg_Read(CFG_KEY_BASIC, (u8 *)&cfg, BASIC_CFG_LEN));
+    TEST_ASSERT_EQUAL_MEMORY(((u8[]){192, 168, 1, 20}), cfg.ip, 4);
+}
+
+static void test_post_unknown_url_not_found(void)
+{
+    receive("POST /logo.png HTTP/1.1\r\nContent-Length: 2\r\n\r\nab");
+    TEST_ASSERT_EQUAL(strlen(RES_NOT_FOUND), sent_len);
+    TEST_ASSERT_EQUAL_MEMORY(RES_NOT_FOUND, sent, strlen(RES_NOT_FOUND));
+}
+
+static void test_template_filled_in(void)
+{
+    const char *body;
+
+    strcpy(web_vars[WEB_VAR_MAC], "1.2.3.4.5.6");
+    strcpy(web_vars[WEB_VAR_SIP], "192.168.1.10");
+    strcpy(web_vars[WEB_VAR_MSK], "");
+    strcpy(web_vars[WEB_VAR_GAT], "192.168.1.1");
+    receive("GET /basic.html HTTP/1.1\r\n\r\n");
+    sent[sent_len] = 0;
+    body = strstr((char *)sent, "\r\n\r\n") + 4;
+    TEST_ASSERT_EQUAL(atoi(strstr((char *)sent, "Content-Length:") + 15), sent_len - (body - (char *)sent));
+    TEST_ASSERT_EQUAL(Web_TemplateLength(Web_FindRoute(METHOD_GET, "basic.html")->tpl), sent_len - (body - (char *)sent));
+    TEST_ASSERT_EQUAL(1, count("f.__PMAC.value=\"1.2.3.4.5.6\";"));
+    TEST_ASSERT_EQUAL(1, count("f.__PSIP.value=\"192.168.1.10\";"));
+    TEST_ASSERT_EQUAL(1, count("f.__PMSK.value=\"\";"));
+    TEST_ASSERT_EQUAL(1, count("f.__PGAT.value=\"192.168.1.1\";"));
+    TEST_ASSERT_EQUAL(0, count("__A"));
+    TEST_ASSERT_EQUAL(1, count("</html>"));
+}
+
+static void test_template_sent_in_full_segments(void)
+{
+    u32 len;
+    int rounds = 0;
+
+    strcpy(web_vars[WEB_VAR_USE], "admin");
+    strcpy(web_vars[WEB_VAR_PAS], "123");
+    len = Web_TemplateLength(Web_FindRoute(METHOD_GET, "login.html")->tpl);
+    TEST_ASSERT_TRUE(len > WCHNET_TCP_MSS);
+    /* "/" is the login page */
+    receive("GET / HTTP/1.1\r\n\r\n");
+    /* the header and one call per MSS of the page */
+    TEST_ASSERT_EQUAL(1 + (len + WCHNET_TCP_MSS - 1) / WCHNET_TCP_MSS, send_calls);
+    TEST_ASSERT_EQUAL(1, count("f.__PUSE.value==\"admin\""));
+
+    /* the same with a small send window, variables split across segments */
+    sent_len = 0;
+    send_window = 7;
+    receive("GET /login.html HTTP/1.1\r\n\r\n");
+    while(Web_TxPending(1) && rounds < 1000)
+    {
+        send_window = 7;
+        Web_SendPending();
+        rounds++;
+    }
+    TEST_ASSERT_EQUAL(1, count("f.__PUSE.value==\"admin\""));
+    TEST_ASSERT_EQUAL(1, count("f.__PPAS.value==\"123\""));
+    TEST_ASSERT_EQUAL(1, count("</html>"));
+}
+
+static void test_keep_alive(void)
+{
+    receive("GET /style.css HTTP/1.1\r\n\r\n");
+    receive("HEAD /main.html HTTP/1.1\r\n\r\n");
+    receive("GET /a HTTP/1.1\r\n\r\n");
+    TEST_ASSERT_EQUAL(2, count("HTTP/1.1 200 OK"));
+    TEST_ASSERT_EQUAL(1, count("HTTP/1.1 404"));
+    TEST_ASSERT_FALSE(socket_closed);
+    receive("GET /a HTTP/1.0\r\n\r\n");
+    TEST_ASSERT_TRUE(socket_closed);
+}
+
+static void test_request_split_across_segments(void)
+{
+    /* the ring wraps around in the middle of the second request */
+    receive("GET /missing1 HTTP/1.1\r\nHost: 192.168.1.10\r\n\r\n");
+    receive("GET /miss");
+    receive("ing2 HTTP/1.1\r\nHo");
+    TEST_ASSERT_EQUAL(1, count("HTTP/1.1 404"));
+    receive("st: 192.168.1.10\r\n");
+    receive("\r\n");
+    TEST_ASSERT_EQUAL(2, count("HTTP/1.1 404"));
+    TEST_ASSERT_EQUAL(0, SocketInf[1].RecvRemLen);
+}
+
+static void test_pipelined_requests_wait_for_body(void)
+{
+    const Web_Asset_t *asset = Web_FindRoute(METHOD_GET, "logo.png")->asset;
+    int rounds = 0;
+
+    send_window = 100;
+    receive("GET /logo.png HTTP/1.1\r\n\r\nGET /missing HTTP/1.1\r\n\r\n");
+    /* the second request stays in the receive buffer until the body is sent */
+    TEST_ASSERT_EQUAL(strlen("GET /missing HTTP/1.1\r\n\r\n"), SocketInf[1].RecvRemLen);
+    while(SocketInf[1].RecvRemLen && rounds < 100)
+    {
+        send_window = 300;
+        Web_SendPending();
+        rounds++;
+    }
+    TEST_ASSERT_EQUAL(0, SocketInf[1].RecvRemLen);
+    TEST_ASSERT_TRUE(sent_len > asset->len + strlen(RES_NOT_FOUND));
+    TEST_ASSERT_EQUAL_MEMORY(RES_NOT_FOUND, &sent[sent_len - strlen(RES_NOT_FOUND)], strlen(RES_NOT_FOUND));
+    TEST_ASSERT_FALSE(socket_closed);
+}
+
+static void test_post_body_too_large(void)
+{
+    char req[64];
+
+    snprintf(req, sizeof(req), "POST /success.html HTTP/1.1\r\nContent-Length: %d\r\n\r\n", HTTP_BODY_LEN);
+    receive(req);
+    while(SocketInf[1].RecvRemLen + 32 <= sizeof(ring[1]) && sent_len == 0)
+        receive("__PUSE=aaaaaaaaaaaaaaaaaaaaaaaa&");
+    TEST_ASSERT_EQUAL_MEMORY(RES_TOO_LARGE, sent, strlen(RES_TOO_LARGE));
+    TEST_ASSERT_TRUE(socket_closed);
+}
+
+static void test_stream_dropped_on_disconnect(void)
+{
+    send_window = 200;
+    receive("GET /png1.png HTTP/1.1\r\n\r\n");
+    Web_SocketClosed(1);
+    send_window = UINT32_MAX;
+    sent_len = 0;
+    Web_SendPending();
+    TEST_ASSERT_EQUAL(0, sent_len);
+    TEST_ASSERT_FALSE(socket_closed);
+}
+
+static void test_sessions_are_independent(void)
+{
+    const Web_Route_t *logo = Web_FindRoute(METHOD_GET, "logo.png");
+    const Web_Route_t *style = Web_FindRoute(METHOD_GET, "style.css");
+    u8 header[200];
+    int rounds = 0;
+
+    /* the header goes out at once, the body later */
+    Web_SocketOpened(2);
+    receive_on(1, "GET /logo.png HTTP/1.1\r\nHo");
+    send_window = MakeAssetResponse(header, style, style->asset, 0);
+    receive_on(2, "GET /style.css HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n");
+    send_window = MakeAssetResponse(header, logo, logo->asset, 0);
+    receive_on(1, "st: 192.168.1.10\r\n\r\n");
+    TEST_ASSERT_TRUE(Web_TxPending(1) && Web_TxPending(2));
+    /* both bodies are sent at the same time */
+    while((Web_TxPending(1) || Web_TxPending(2)) && rounds < 100)
+    {
+        send_window = 300;
+        Web_SendPending();
+        rounds++;
+    }
+    TEST_ASSERT_EQUAL(MakeAssetResponse(header, logo, logo->asset, 0) + logo->asset->len, sent_to[1]);
+    TEST_ASSERT_EQUAL(MakeAssetResponse(header, style, style->asset, 0) + style->asset->len, sent_to[2]);
+    TEST_ASSERT_FALSE(socket_closed);
+}
+
+static void test_response_queued_while_window_full(void)
+{
+    const Web_Route_t *style = Web_FindRoute(METHOD_GET, "style.css");
+    u8 header[200];
+    u32 len = MakeAssetResponse(header, style, style->asset, 0);
+    int rounds = 0;
+
+    send_window = 0;
+    receive("GET /style.css HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n");
+    TEST_ASSERT_EQUAL(0, sent_len);
+    TEST_ASSERT_EQUAL(len + style->asset->len, Web_TxPending(1));
+    TEST_ASSERT_EQUAL(0, Web_SendPending());
+    while(Web_TxPending(1) && rounds < 100)
+    {
+        send_window = 50;
+        TEST_ASSERT_EQUAL(1, Web_SendPending());
+        rounds++;
+    }
+    TEST_ASSERT_EQUAL(0, Web_SendPending());
+    TEST_ASSERT_EQUAL(len + style->asset->len, sent_len);
+    TEST_ASSERT_EQUAL_MEMORY(header, sent, len);
+    TEST_ASSERT_EQUAL_MEMORY(style->asset->data, &sent[len], style->asset->len);
+}
+
+static void test_session_pool_exhausted(void)
+{
+    u8 id;
+
+    for(id = 2; id <= HTTP_SESSIONS; id++)
+        Web_SocketOpened(id);
+    TEST_ASSERT_FALSE(socket_closed);
+    Web_SocketOpened(HTTP_SESSIONS + 1);
+    TEST_ASSERT_TRUE(socket_closed);
+    TEST_ASSERT_NULL(Web_Session(HTTP_SESSIONS + 1));
+    /* a closed connection makes room for the next one */
+    Web_SocketClosed(2);
+    Web_SocketOpened(HTTP_SESSIONS + 1);
+    TEST_ASSERT_NOT_NULL(Web_Session(HTTP_SESSIONS + 1));
+}
+
+static void test_idle_connection_closed(void)
+{
+    receive("GET /style.css HTTP/1.1\r\n\r\n");
+    LocalTime += HTTP_IDLE_TIMEOUT - 10;
+    Web_SendPending();
+    TEST_ASSERT_FALSE(socket_closed);
+    receive("GET /a HTTP/1.1\r\n\r\n");
+    LocalTime += HTTP_IDLE_TIMEOUT - 10;
+    Web_SendPending();
+    TEST_ASSERT_FALSE(socket_closed);
+    LocalTime += 10;
+    Web_SendPending();
+    TEST_ASSERT_TRUE(socket_closed);
+    TEST_ASSERT_NULL(Web_Session(1));
+}
+
+static void test_parse_request_timing(void)
+{
+    static const char req[] = "GET /main.html HTTP/1.1\r\nHost: 192.168.1.10\r\nAccept: */*\r\n\r\n";
+    char msg[64];
+    uint64_t start;
+    int i;
+
+    start = host_shim_now_ns();
+    for(i = 0; i < 100000; i++)
+    {
+        Http_ParserInit(&parser);
+        ParseHttpData(&parser, (const u8 *)req, sizeof(req) - 1);
+    }
+    snprintf(msg, sizeof(msg), "ParseHttpData: %.1f ns per request",
+             (double)(host_shim_now_ns() - start) / 100000);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_STRING("main.html", parser.request.URL);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_get_request);
+    RUN_TEST(test_parse_post_request);
+    RUN_TEST(test_parse_unknown_method);
+    RUN_TEST(test_parse_connection_close);
+    RUN_TEST(test_parse_byte_by_byte);
+    RUN_TEST(test_url_decode);
+    RUN_TEST(test_url_decode_rejects_bad_input);
+    RUN_TEST(test_refresh_basic_stores_config);
+    RUN_TEST(test_static_asset_streamed_from_flash);
+    RUN_TEST(test_asset_gzip_and_etag_headers);
+    RUN_TEST(test_asset_identity_without_gzip);
+    RUN_TEST(test_accept_encoding_parsed);
+    RUN_TEST(test_asset_not_modified);
+    RUN_TEST(test_unknown_url_not_found);
+    RUN_TEST(test_route_matches_whole_path);
+    RUN_TEST(test_head_sends_header_only);
+    RUN_TEST(test_post_route_calls_handler);
+    RUN_TEST(test_post_unknown_url_not_found);
+    RUN_TEST(test_template_filled_in);
+    RUN_TEST(test_template_sent_in_full_segments);
+    RUN_TEST(test_keep_alive);
+    RUN_TEST(test_request_split_across_segments);
+    RUN_TEST(test_pipelined_requests_wait_for_body);
+    RUN_TEST(test_post_body_too_large);
+    RUN_TEST(test_stream_dropped_on_disconnect);
+    RUN_TEST(test_sessions_are_independent);
+    RUN_TEST(test_response_queued_while_window_full);
+    RUN_TEST(test_session_pool_exhausted);
+    RUN_TEST(test_idle_connection_closed);
+    RUN_TEST(test_parse_request_timing);
+    return UNITY_END();
+}
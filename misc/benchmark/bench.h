@@ -0,0 +1,58 @@
+/*
+ * Benchmark harness for the "benchmark" target (see misc/scripts/benchmark.py).
+ *
+ * Kernels are registered with BENCHMARK(name, iterations) and run under an
+ * emulator; mcycle / minstret are read around the given number of
+ * iterations. Projects can add their own kernels as C files in the
+ * benchmark/ directory of the project:
+ *
+ *   #include <bench.h>
+ *   BENCHMARK(my_filter, 100)
+ *   {
+ *       for (uint32_t i = 0; i < iterations; i++)
+ *           bench_do_not_optimize(filter(samples));
+ *   }
+ */
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <stdint.h>
+
+typedef struct
+{
+    const char *name;
+    void (*fn)(uint32_t iterations);
+    uint32_t iterations;
+} bench_t;
+
+#define BENCHMARK(name, iter)                                                   \
+    static void bench_##name(uint32_t iterations);                              \
+    static const bench_t bench_entry_##name                                     \
+        __attribute__((used, section(".bench_table"))) = {#name, bench_##name, iter}; \
+    static void bench_##name(uint32_t iterations)
+
+/* keeps the compiler from optimizing away a result */
+#define bench_do_not_optimize(value) __asm__ volatile("" : : "r"(value) : "memory")
+
+static inline uint32_t bench_read_mcycle(void)
+{
+    uint32_t value;
+    __asm__ volatile("csrr %0, mcycle" : "=r"(value));
+    return value;
+}
+
+static inline uint32_t bench_read_minstret(void)
+{
+    uint32_t value;
+    __asm__ volatile("csrr %0, minstret" : "=r"(value));
+    return value;
+}
+
+void bench_puts(const char *s);
+void bench_exit(int code) __attribute__((noreturn));
+
+/* start.S */
+void bench_switch(uint32_t **from_sp, uint32_t *to_sp);
+uint32_t *bench_init_task_stack(uint32_t *stack_top, void (*entry)(void));
+
+#endif /* __BENCH_H__ */
@@ -0,0 +1,156 @@
+/*
+ * Default benchmark kernels: C library hot spots, interrupt entry / exit
+ * and the primitives an RTOS is built from (context switch, queue).
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+
+#define VIRT_CLINT_MSIP 0x02000000UL
+
+#define MSTATUS_MIE 0x8
+#define MIE_MSIE    0x8
+
+extern volatile uint32_t bench_irq_count;
+
+static uint32_t src_buf[256];
+static uint32_t dst_buf[256];
+
+BENCHMARK(memcpy_1k, 100)
+{
+    for(uint32_t i = 0; i < iterations; i++)
+    {
+        memcpy(dst_buf, src_buf, sizeof(dst_buf));
+        bench_do_not_optimize(dst_buf);
+    }
+}
+
+BENCHMARK(memcpy_unaligned_1k, 100)
+{
+    for(uint32_t i = 0; i < iterations; i++)
+    {
+        memcpy((uint8_t *)dst_buf + 1, (uint8_t *)src_buf + 3, sizeof(dst_buf) - 4);
+        bench_do_not_optimize(dst_buf);
+    }
+}
+
+BENCHMARK(memset_1k, 100)
+{
+    for(uint32_t i = 0; i < iterations; i++)
+    {
+        memset(dst_buf, (int)i, sizeof(dst_buf));
+        bench_do_not_optimize(dst_buf);
+    }
+}
+
+BENCHMARK(snprintf_int, 100)
+{
+    char buf[64];
+
+    for(uint32_t i = 0; i < iterations; i++)
+    {
+        snprintf(buf, sizeof(buf), "%d %u 0x%08lx %s", -(int)i, (unsigned)i, (unsigned long)i, "str");
+        bench_do_not_optimize(buf);
+    }
+}
+
+BENCHMARK(isr_entry, 100)
+{
+    uint32_t count = bench_irq_count;
+
+    __asm__ volatile("csrs mie, %0" : : "r"(MIE_MSIE));
+    __asm__ volatile("csrs mstatus, %0" : : "r"(MSTATUS_MIE));
+    for(uint32_t i = 0; i < iterations; i++)
+    {
+        *(volatile uint32_t *)VIRT_CLINT_MSIP = 1;
+        while(bench_irq_count == count)
+            ;
+        count = bench_irq_count;
+    }
+    __asm__ volatile("csrc mstatus, %0" : : "r"(MSTATUS_MIE));
+}
+
+/* two tasks switching back and forth, two context switches per iteration */
+static uint32_t  task_stack[128];
+static uint32_t *main_sp;
+static uint32_t *task_sp;
+
+static void switch_task(void)
+{
+    while(1)
+        bench_switch(&task_sp, main_sp);
+}
+
+BENCHMARK(context_switch, 100)
+{
+    task_sp = bench_init_task_stack(&task_stack[128], switch_task);
+    for(uint32_t i = 0; i < iterations; i++)
+        bench_switch(&main_sp, task_sp);
+}
+
+/* queue send / receive in a critical section, like xQueueSend / xQueueReceive
+   without blocking */
+typedef struct
+{
+    uint32_t items[16];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t count;
+} queue_t;
+
+static queue_t queue;
+
+static inline uint32_t enter_critical(void)
+{
+    uint32_t mstatus;
+    __asm__ volatile("csrrci %0, mstatus, %1" : "=r"(mstatus) : "i"(MSTATUS_MIE));
+    return mstatus;
+}
+
+static inline void exit_critical(uint32_t mstatus)
+{
+    __asm__ volatile("csrw mstatus, %0" : : "r"(mstatus));
+}
+
+static int __attribute__((noinline)) queue_send(queue_t *q, uint32_t item)
+{
+    uint32_t state = enter_critical();
+    int      ok = q->count < 16;
+
+    if(ok)
+    {
+        q->items[q->head] = item;
+        q->head = (q->head + 1) & 15;
+        q->count++;
+    }
+    exit_critical(state);
+    return ok;
+}
+
+static int __attribute__((noinline)) queue_receive(queue_t *q, uint32_t *item)
+{
+    uint32_t state = enter_critical();
+    int      ok = q->count > 0;
+
+    if(ok)
+    {
+        *item = q->items[q->tail];
+        q->tail = (q->tail + 1) & 15;
+        q->count--;
+    }
+    exit_critical(state);
+    return ok;
+}
+
+BENCHMARK(queue_send_receive, 100)
+{
+    uint32_t item;
+
+    for(uint32_t i = 0; i < iterations; i++)
+    {
+        queue_send(&queue, i);
+        queue_receive(&queue, &item);
+        bench_do_not_optimize(item);
+    }
+}
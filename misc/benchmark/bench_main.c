@@ -0,0 +1,98 @@
+/*
+ * Benchmark runner for the QEMU "virt" machine: runs every kernel in the
+ * .bench_table section and prints one line per kernel on the UART:
+ *
+ *   BENCH <name> <iterations> <mcycle delta> <minstret delta>
+ */
+#include <stdint.h>
+#include "bench.h"
+
+#define VIRT_UART0      0x10000000UL
+#define VIRT_TEST       0x00100000UL
+#define VIRT_CLINT_MSIP 0x02000000UL
+
+#define UART_THR (*(volatile uint8_t *)(VIRT_UART0 + 0))
+#define UART_LSR (*(volatile uint8_t *)(VIRT_UART0 + 5))
+#define UART_LSR_THRE 0x20
+
+extern const bench_t __bench_table_start[];
+extern const bench_t __bench_table_end[];
+
+volatile uint32_t bench_irq_count;
+
+void bench_puts(const char *s)
+{
+    while(*s)
+    {
+        while(!(UART_LSR & UART_LSR_THRE))
+            ;
+        UART_THR = (uint8_t)*s++;
+    }
+}
+
+static void bench_put_uint(uint32_t value)
+{
+    char buf[11];
+    int  pos = sizeof(buf) - 1;
+
+    buf[pos] = '\0';
+    do
+    {
+        buf[--pos] = (char)('0' + value % 10);
+        value /= 10;
+    } while(value);
+    bench_puts(&buf[pos]);
+}
+
+void bench_exit(int code)
+{
+    /* SiFive test device: 0x5555 = pass, (code << 16) | 0x3333 = fail */
+    *(volatile uint32_t *)VIRT_TEST = code ? (((uint32_t)code << 16) | 0x3333) : 0x5555;
+    while(1)
+        ;
+}
+
+void bench_trap_handler(uint32_t mcause)
+{
+    if(mcause == 0x80000003UL)
+    {
+        /* machine software interrupt, raised by the isr_entry kernel */
+        *(volatile uint32_t *)VIRT_CLINT_MSIP = 0;
+        bench_irq_count++;
+        return;
+    }
+    bench_puts("BENCH_ERROR unexpected trap, mcause ");
+    bench_put_uint(mcause);
+    bench_puts("\n");
+    bench_exit(2);
+}
+
+int main(void)
+{
+    const bench_t *bench;
+
+    for(bench = __bench_table_start; bench < __bench_table_end; bench++)
+    {
+        uint32_t cycles, instret;
+
+        /* warm up, e.g. for lazily initialized state in the C library */
+        bench->fn(1);
+        cycles = bench_read_mcycle();
+        instret = bench_read_minstret();
+        bench->fn(bench->iterations);
+        cycles = bench_read_mcycle() - cycles;
+        instret = bench_read_minstret() - instret;
+
+        bench_puts("BENCH ");
+        bench_puts(bench->name);
+        bench_puts(" ");
+        bench_put_uint(bench->iterations);
+        bench_puts(" ");
+        bench_put_uint(cycles);
+        bench_puts(" ");
+        bench_put_uint(instret);
+        bench_puts("\n");
+    }
+    bench_puts("BENCH_DONE\n");
+    bench_exit(0);
+}
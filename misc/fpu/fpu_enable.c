@@ -0,0 +1,17 @@
+/*
+ * Built for board_build.fpu = yes (see builder/frameworks/noneos_sdk.py).
+ *
+ * SystemInit() is wrapped with -Wl,--wrap=SystemInit, so the FPU is on
+ * before the first C code compiled for ilp32f runs, whatever the startup
+ * file of the SDK does with mstatus. FS is set to dirty (0b11) as none of
+ * the RTOS ports tracks the FP state lazily.
+ */
+#define MSTATUS_FS_DIRTY 0x6000
+
+void __real_SystemInit(void);
+
+void __wrap_SystemInit(void)
+{
+    __asm__ volatile("csrs mstatus, %0" : : "r"(MSTATUS_FS_DIRTY));
+    __real_SystemInit();
+}
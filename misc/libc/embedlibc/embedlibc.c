@@ -0,0 +1,627 @@
+/*
+ * embedlibc: lean printf family for board_build.libc = embedlibc (see
+ * builder/frameworks/_bare.py), modeled on the mini-printf of the
+ * baremetal-ch32v003 example but usable with the SDK.
+ *
+ * Only the formatted output functions are replaced. newlib-nano still
+ * provides the headers and everything else (string functions, malloc, ...).
+ * printf / puts / putchar write through _write(1, ...) like newlib does, so
+ * the SDK Debug code (USART or SDI printf) works unchanged.
+ *
+ * Supported: flags "-+ #0", width and precision (also as "*"), the length
+ * modifiers hh h l ll j z t and the conversions d i u o x X c s p %.
+ * Floating point (f F e E g G) only with EMBEDLIBC_FLOAT_PRINTF, which is
+ * set by board_build.libc_float_printf = yes. Halfway cases are rounded up
+ * and %f of values >= 1e19 is printed in exponent form. 64-bit values are
+ * divided in 16-bit steps, so the 64-bit division of libgcc is not pulled in.
+ */
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#undef putchar
+
+int _write(int fd, char *buf, int size);
+
+#define FLAG_LEFT  0x01
+#define FLAG_PLUS  0x02
+#define FLAG_SPACE 0x04
+#define FLAG_ZERO  0x08
+#define FLAG_ALT   0x10
+#define FLAG_UPPER 0x20
+
+typedef struct
+{
+    char  *buf;      /* NULL: output goes to _write() through chunk */
+    size_t size;     /* size of buf, including the terminating zero */
+    size_t count;    /* characters produced so far */
+    int    fill;
+    char   chunk[32];
+} out_t;
+
+static void out_flush(out_t *out)
+{
+    if(out->fill)
+        _write(1, out->chunk, out->fill);
+    out->fill = 0;
+}
+
+static void out_char(out_t *out, char c)
+{
+    if(out->buf == NULL)
+    {
+        out->chunk[out->fill++] = c;
+        if(out->fill == (int)sizeof(out->chunk))
+            out_flush(out);
+    }
+    else if(out->count + 1 < out->size)
+    {
+        out->buf[out->count] = c;
+    }
+    out->count++;
+}
+
+static void out_repeat(out_t *out, char c, int n)
+{
+    while(n-- > 0)
+        out_char(out, c);
+}
+
+static void out_mem(out_t *out, const char *s, int len)
+{
+    while(len-- > 0)
+        out_char(out, *s++);
+}
+
+/* prefix (sign, 0x), leading zeros and digits, padded to width */
+static void out_field(out_t *out, const char *prefix, int zeros, const char *digits, int len,
+                      int width, int flags)
+{
+    int prefix_len = 0;
+    int pad;
+
+    while(prefix[prefix_len])
+        prefix_len++;
+    pad = width - prefix_len - zeros - len;
+    if(!(flags & (FLAG_LEFT | FLAG_ZERO)))
+        out_repeat(out, ' ', pad);
+    out_mem(out, prefix, prefix_len);
+    if((flags & (FLAG_LEFT | FLAG_ZERO)) == FLAG_ZERO)
+        out_repeat(out, '0', pad);
+    out_repeat(out, '0', zeros);
+    out_mem(out, digits, len);
+    if(flags & FLAG_LEFT)
+        out_repeat(out, ' ', pad);
+}
+
+static unsigned div_u64(uint64_t *value, unsigned base)
+{
+    uint64_t quotient = 0;
+    uint32_t rem = 0;
+    int      shift;
+
+    for(shift = 48; shift >= 0; shift -= 16)
+    {
+        uint32_t part = (rem << 16) | (uint32_t)((*value >> shift) & 0xFFFF);
+
+        quotient |= (uint64_t)(part / base) << shift;
+        rem = part % base;
+    }
+    *value = quotient;
+    return rem;
+}
+
+/* writes the digits backwards from end, returns their number */
+static int format_uint(char *end, uint64_t value, unsigned base, int flags)
+{
+    const char *digits = (flags & FLAG_UPPER) ? "0123456789ABCDEF" : "0123456789abcdef";
+    char       *p = end;
+
+    while(value)
+    {
+        unsigned digit;
+
+        if(value >> 32)
+        {
+            digit = div_u64(&value, base);
+        }
+        else
+        {
+            uint32_t value32 = (uint32_t)value;
+
+            digit = value32 % base;
+            value = value32 / base;
+        }
+        *--p = digits[digit];
+    }
+    return (int)(end - p);
+}
+
+static void out_int(out_t *out, uint64_t value, int negative, unsigned base, int width, int prec,
+                    int flags)
+{
+    char        buf[24];
+    const char *prefix = "";
+    int         len = format_uint(buf + sizeof(buf), value, base, flags);
+    int         zeros = 0;
+
+    if(negative)
+        prefix = "-";
+    else if(flags & FLAG_PLUS)
+        prefix = "+";
+    else if(flags & FLAG_SPACE)
+        prefix = " ";
+    if(prec >= 0)
+        flags &= ~FLAG_ZERO;
+    else
+        prec = 1;
+    if(prec > len)
+        zeros = prec - len;
+    if(flags & FLAG_ALT)
+    {
+        if(base == 8 && zeros == 0)
+            zeros = 1;
+        else if(base == 16 && value)
+            prefix = (flags & FLAG_UPPER) ? "0X" : "0x";
+    }
+    out_field(out, prefix, zeros, buf + sizeof(buf) - len, len, width, flags);
+}
+
+#ifdef EMBEDLIBC_FLOAT_PRINTF
+/* normalizes value to [1, 10) after rounding to prec digits after the point */
+static int normalize(double *value, int prec)
+{
+    double v = *value;
+    double round = 0.5;
+    int    exp = 0;
+    int    i;
+
+    if(v != 0)
+    {
+        while(v >= 10)
+        {
+            v /= 10;
+            exp++;
+        }
+        while(v < 1)
+        {
+            v *= 10;
+            exp--;
+        }
+    }
+    for(i = 0; i < prec; i++)
+        round /= 10;
+    v += round;
+    if(v >= 10)
+    {
+        v /= 10;
+        exp++;
+    }
+    *value = v;
+    return exp;
+}
+
+static int format_exp(char *p, double value, int prec, int flags)
+{
+    char *start = p;
+    int   exp = normalize(&value, prec);
+    int   digit;
+    int   i;
+
+    digit = (int)value;
+    *p++ = (char)('0' + digit);
+    if(prec || (flags & FLAG_ALT))
+        *p++ = '.';
+    for(i = 0; i < prec; i++)
+    {
+        value = (value - digit) * 10;
+        digit = (int)value;
+        *p++ = (char)('0' + digit);
+    }
+    *p++ = (flags & FLAG_UPPER) ? 'E' : 'e';
+    *p++ = exp < 0 ? '-' : '+';
+    if(exp < 0)
+        exp = -exp;
+    if(exp >= 100)
+        *p++ = (char)('0' + exp / 100);
+    *p++ = (char)('0' + exp / 10 % 10);
+    *p++ = (char)('0' + exp % 10);
+    return (int)(p - start);
+}
+
+static int format_fixed(char *p, double value, int prec, int flags)
+{
+    char    *start = p;
+    double   round = 0.5;
+    uint64_t ipart;
+    int      i;
+
+    for(i = 0; i < prec; i++)
+        round /= 10;
+    value += round;
+    ipart = (uint64_t)value;
+    value -= (double)ipart;
+    if(ipart)
+    {
+        char digits[20];
+        int  len = format_uint(digits + sizeof(digits), ipart, 10, 0);
+
+        for(i = 0; i < len; i++)
+            *p++ = digits[sizeof(digits) - len + i];
+    }
+    else
+    {
+        *p++ = '0';
+    }
+    if(prec || (flags & FLAG_ALT))
+        *p++ = '.';
+    for(i = 0; i < prec; i++)
+    {
+        int digit;
+
+        value *= 10;
+        digit = (int)value;
+        *p++ = (char)('0' + digit);
+        value -= digit;
+    }
+    return (int)(p - start);
+}
+
+/* removes trailing zeros of the fraction (and the point) for %g */
+static int strip_zeros(char *buf, int len)
+{
+    int point = -1;
+    int exp_start = len;
+    int i;
+
+    for(i = 0; i < len; i++)
+    {
+        if(buf[i] == '.')
+            point = i;
+        else if(buf[i] == 'e' || buf[i] == 'E')
+            exp_start = i;
+    }
+    if(point < 0)
+        return len;
+    i = exp_start;
+    while(i > point + 1 && buf[i - 1] == '0')
+        i--;
+    if(i == point + 1)
+        i = point;
+    for(; exp_start < len; exp_start++)
+        buf[i++] = buf[exp_start];
+    return i;
+}
+
+static void out_double(out_t *out, double value, char conv, int width, int prec, int flags)
+{
+    char        buf[64];
+    const char *prefix = "";
+    int         len;
+
+    if(value < 0 || (value == 0 && 1 / value < 0))
+    {
+        prefix = "-";
+        value = -value;
+    }
+    else if(flags & FLAG_PLUS)
+    {
+        prefix = "+";
+    }
+    else if(flags & FLAG_SPACE)
+    {
+        prefix = " ";
+    }
+    if(conv == 'F' || conv == 'E' || conv == 'G')
+        flags |= FLAG_UPPER;
+    if(value != value || value > 1.7976931348623157e308)
+    {
+        const char *s = value != value ? ((flags & FLAG_UPPER) ? "NAN" : "nan")
+                                       : ((flags & FLAG_UPPER) ? "INF" : "inf");
+
+        out_field(out, prefix, 0, s, 3, width, flags & ~FLAG_ZERO);
+        return;
+    }
+    if(prec < 0)
+        prec = 6;
+    /* the digits beyond that are noise anyway */
+    if(prec > 40)
+        prec = 40;
+    if(conv == 'g' || conv == 'G')
+    {
+        double normalized = value;
+        int    exp;
+
+        if(prec == 0)
+            prec = 1;
+        exp = normalize(&normalized, prec - 1);
+        if(value == 0)
+            exp = 0;
+        if(exp >= -4 && exp < prec && value < 1e19)
+            len = format_fixed(buf, value, prec - 1 - exp, flags);
+        else
+            len = format_exp(buf, value, prec - 1, flags);
+        if(!(flags & FLAG_ALT))
+            len = strip_zeros(buf, len);
+    }
+    else if((conv == 'f' || conv == 'F') && value < 1e19)
+    {
+        if(prec > 20)
+            prec = 20;
+        len = format_fixed(buf, value, prec, flags);
+    }
+    else
+    {
+        len = format_exp(buf, value, prec, flags);
+    }
+    out_field(out, prefix, 0, buf, len, width, flags);
+}
+#endif
+
+static int format(out_t *out, const char *fmt, va_list ap)
+{
+    char c;
+
+    while((c = *fmt++) != '\0')
+    {
+        int      flags = 0;
+        int      width = 0;
+        int      prec = -1;
+        int      length = 0;
+        int      negative = 0;
+        unsigned base = 10;
+        uint64_t value;
+
+        if(c != '%')
+        {
+            out_char(out, c);
+            continue;
+        }
+        for(;; fmt++)
+        {
+            if(*fmt == '-')
+                flags |= FLAG_LEFT;
+            else if(*fmt == '+')
+                flags |= FLAG_PLUS;
+            else if(*fmt == ' ')
+                flags |= FLAG_SPACE;
+            else if(*fmt == '#')
+                flags |= FLAG_ALT;
+            else if(*fmt == '0')
+                flags |= FLAG_ZERO;
+            else
+                break;
+        }
+        if(*fmt == '*')
+        {
+            width = va_arg(ap, int);
+            if(width < 0)
+            {
+                flags |= FLAG_LEFT;
+                width = -width;
+            }
+            fmt++;
+        }
+        else
+        {
+            while(*fmt >= '0' && *fmt <= '9')
+                width = width * 10 + (*fmt++ - '0');
+        }
+        if(*fmt == '.')
+        {
+            fmt++;
+            prec = 0;
+            if(*fmt == '*')
+            {
+                prec = va_arg(ap, int);
+                fmt++;
+            }
+            else
+            {
+                while(*fmt >= '0' && *fmt <= '9')
+                    prec = prec * 10 + (*fmt++ - '0');
+            }
+        }
+        /* length: -2 hh, -1 h, 1 l, 2 ll / j, 3 z / t */
+        switch(*fmt)
+        {
+            case 'h':
+                length = fmt[1] == 'h' ? -2 : -1;
+                fmt += fmt[1] == 'h' ? 2 : 1;
+                break;
+            case 'l':
+                length = fmt[1] == 'l' ? 2 : 1;
+                fmt += fmt[1] == 'l' ? 2 : 1;
+                break;
+            case 'j':
+                length = 2;
+                fmt++;
+                break;
+            case 'z':
+            case 't':
+                length = 3;
+                fmt++;
+                break;
+        }
+
+        c = *fmt++;
+        switch(c)
+        {
+            case 'd':
+            case 'i':
+            {
+                int64_t svalue;
+
+                if(length == 2)
+                    svalue = va_arg(ap, long long);
+                else if(length == 1)
+                    svalue = va_arg(ap, long);
+                else if(length == 3)
+                    svalue = va_arg(ap, ptrdiff_t);
+                else
+                    svalue = va_arg(ap, int);
+                if(length == -1)
+                    svalue = (short)svalue;
+                else if(length == -2)
+                    svalue = (signed char)svalue;
+                negative = svalue < 0;
+                value = negative ? (uint64_t)0 - (uint64_t)svalue : (uint64_t)svalue;
+                out_int(out, value, negative, 10, width, prec, flags & ~FLAG_ALT);
+                break;
+            }
+            case 'X':
+                flags |= FLAG_UPPER;
+                /* fall through */
+            case 'x':
+                base = 16;
+                /* fall through */
+            case 'o':
+                if(c == 'o')
+                    base = 8;
+                /* fall through */
+            case 'u':
+                if(length == 2)
+                    value = va_arg(ap, unsigned long long);
+                else if(length == 1)
+                    value = va_arg(ap, unsigned long);
+                else if(length == 3)
+                    value = va_arg(ap, size_t);
+                else
+                    value = va_arg(ap, unsigned int);
+                if(length == -1)
+                    value = (unsigned short)value;
+                else if(length == -2)
+                    value = (unsigned char)value;
+                out_int(out, value, 0, base, width, prec,
+                        flags & ~(FLAG_PLUS | FLAG_SPACE | (base == 10 ? FLAG_ALT : 0)));
+                break;
+            case 'p':
+                value = (uintptr_t)va_arg(ap, void *);
+                out_int(out, value, 0, 16, width, prec, (flags | FLAG_ALT) & ~(FLAG_PLUS | FLAG_SPACE));
+                break;
+            case 'c':
+                c = (char)va_arg(ap, int);
+                out_field(out, "", 0, &c, 1, width, flags & ~FLAG_ZERO);
+                break;
+            case 's':
+            {
+                const char *s = va_arg(ap, const char *);
+                int         len = 0;
+
+                if(s == NULL)
+                    s = "(null)";
+                while(s[len] && (prec < 0 || len < prec))
+                    len++;
+                out_field(out, "", 0, s, len, width, flags & ~FLAG_ZERO);
+                break;
+            }
+#ifdef EMBEDLIBC_FLOAT_PRINTF
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+                out_double(out, va_arg(ap, double), c, width, prec, flags);
+                break;
+#endif
+            case '\0':
+                fmt--;
+                break;
+            default:
+                /* unsupported conversion (also %%), print it as is */
+                out_char(out, c);
+                break;
+        }
+    }
+    return (int)out->count;
+}
+
+int vsnprintf(char *buf, size_t size, const char *fmt, va_list ap)
+{
+    out_t out;
+    char  dummy;
+    int   count;
+
+    /* with a NULL buffer only the length is computed */
+    out.buf = buf ? buf : &dummy;
+    out.size = buf ? size : 0;
+    out.count = 0;
+    out.fill = 0;
+    count = format(&out, fmt, ap);
+    if(out.size)
+        buf[out.count < out.size ? out.count : out.size - 1] = '\0';
+    return count;
+}
+
+int snprintf(char *buf, size_t size, const char *fmt, ...)
+{
+    va_list ap;
+    int     count;
+
+    va_start(ap, fmt);
+    count = vsnprintf(buf, size, fmt, ap);
+    va_end(ap);
+    return count;
+}
+
+int vsprintf(char *buf, const char *fmt, va_list ap)
+{
+    return vsnprintf(buf, SIZE_MAX, fmt, ap);
+}
+
+int sprintf(char *buf, const char *fmt, ...)
+{
+    va_list ap;
+    int     count;
+
+    va_start(ap, fmt);
+    count = vsnprintf(buf, SIZE_MAX, fmt, ap);
+    va_end(ap);
+    return count;
+}
+
+int vprintf(const char *fmt, va_list ap)
+{
+    out_t out;
+    int   count;
+
+    out.buf = NULL;
+    out.size = 0;
+    out.count = 0;
+    out.fill = 0;
+    count = format(&out, fmt, ap);
+    out_flush(&out);
+    return count;
+}
+
+int printf(const char *fmt, ...)
+{
+    va_list ap;
+    int     count;
+
+    va_start(ap, fmt);
+    count = vprintf(fmt, ap);
+    va_end(ap);
+    return count;
+}
+
+int puts(const char *s)
+{
+    int len = 0;
+
+    while(s[len])
+        len++;
+    _write(1, (char *)s, len);
+    _write(1, (char *)"\n", 1);
+    return len + 1;
+}
+
+int putchar(int c)
+{
+    char ch = (char)c;
+
+    _write(1, &ch, 1);
+    return (unsigned char)ch;
+}
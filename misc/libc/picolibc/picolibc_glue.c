@@ -0,0 +1,81 @@
+/*
+ * Glue for board_build.libc = picolibc (see builder/frameworks/_bare.py).
+ *
+ * picolibc expects the application to provide stdin / stdout / stderr and
+ * sbrk(), its crt0 and linker script (which would also set up thread local
+ * storage) are not used with the SDK startup code and linker scripts. The
+ * streams go through _write() / _read(), so the SDK Debug code works like
+ * with newlib. The streams and sbrk() are weak and can be replaced by the
+ * project.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+int _write(int fd, char *buf, int size);
+int _read(int fd, char *buf, int size) __attribute__((weak));
+
+static int glue_putc(char c, FILE *file)
+{
+    (void)file;
+    return _write(1, &c, 1) == 1 ? (unsigned char)c : EOF;
+}
+
+static int glue_getc(FILE *file)
+{
+    char c;
+
+    (void)file;
+    if(_read == NULL || _read(0, &c, 1) != 1)
+        return EOF;
+    return (unsigned char)c;
+}
+
+static FILE glue_stdio = FDEV_SETUP_STREAM(glue_putc, glue_getc, NULL, _FDEV_SETUP_RW);
+
+FILE *const stdin __attribute__((weak)) = &glue_stdio;
+FILE *const stdout __attribute__((weak)) = &glue_stdio;
+FILE *const stderr __attribute__((weak)) = &glue_stdio;
+
+/* heap between the end of .bss and the stack, symbols of the SDK linker scripts */
+extern char end[];
+extern char _heap_end[];
+
+void *__attribute__((weak)) sbrk(ptrdiff_t incr)
+{
+    static char *heap;
+    char        *prev;
+
+    if(heap == NULL)
+        heap = end;
+    if(incr > _heap_end - heap || incr < end - heap)
+        return (void *)-1;
+    prev = heap;
+    heap += incr;
+    return prev;
+}
+
+#ifdef __THREAD_LOCAL_STORAGE
+/*
+ * picolibc keeps errno and friends in thread local storage, addressed
+ * through tp. Point tp to a zeroed block. Initialized TLS data (.tdata) is
+ * not copied, the variables of picolibc itself start out as zero anyway
+ * (except for the rand() seed, which then starts from 0).
+ */
+static uint8_t glue_tls[128] __attribute__((aligned(16)));
+#endif
+
+int __real_main(void);
+
+/*
+ * Linked with -Wl,--wrap=main. The SDK startup files only call SystemInit()
+ * and main(), no constructors, so tp is set here, before the application
+ * runs. SystemInit() is already wrapped for board_build.fpu.
+ */
+int __wrap_main(void)
+{
+#ifdef __THREAD_LOCAL_STORAGE
+    __asm__ volatile("mv tp, %0" : : "r"(glue_tls));
+#endif
+    return __real_main();
+}
@@ -0,0 +1,257 @@
+/*
+ * Host replacement of the NoneOS SDK core_riscv.h for native builds
+ * (see misc/native/native_env.py).
+ *
+ * Provides the SDK types and the PFIC / SysTick register blocks so that the
+ * series headers (ch32v30x.h, ch32x035.h, ...) and the peripheral drivers
+ * compile with the host compiler. The memory-mapped register and flash
+ * regions are backed by host memory (host_shim.c), CSR accesses go to
+ * plain variables and the interrupt / sleep intrinsics do nothing.
+ */
+#ifndef __CORE_RISCV_H__
+#define __CORE_RISCV_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the WCH interrupt attribute means something else (or nothing) on the host */
+#define interrupt(x)
+
+/* IO definitions */
+#ifdef __cplusplus
+  #define     __I     volatile
+#else
+  #define     __I     volatile const
+#endif
+#define     __O     volatile
+#define     __IO    volatile
+
+/* Standard Peripheral Library old types (maintained for legacy purpose) */
+typedef __I uint64_t vuc64;
+typedef __I uint32_t vuc32;
+typedef __I uint16_t vuc16;
+typedef __I uint8_t  vuc8;
+
+typedef const uint64_t uc64;
+typedef const uint32_t uc32;
+typedef const uint16_t uc16;
+typedef const uint8_t  uc8;
+
+typedef __I int64_t vsc64;
+typedef __I int32_t vsc32;
+typedef __I int16_t vsc16;
+typedef __I int8_t  vsc8;
+
+typedef const int64_t sc64;
+typedef const int32_t sc32;
+typedef const int16_t sc16;
+typedef const int8_t  sc8;
+
+typedef __IO uint64_t vu64;
+typedef __IO uint32_t vu32;
+typedef __IO uint16_t vu16;
+typedef __IO uint8_t  vu8;
+
+typedef uint64_t u64;
+typedef uint32_t u32;
+typedef uint16_t u16;
+typedef uint8_t  u8;
+
+typedef __IO int64_t vs64;
+typedef __IO int32_t vs32;
+typedef __IO int16_t vs16;
+typedef __IO int8_t  vs8;
+
+typedef int64_t s64;
+typedef int32_t s32;
+typedef int16_t s16;
+typedef int8_t  s8;
+
+typedef enum {NoREADY = 0, READY = !NoREADY} ErrorStatus;
+
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+
+#define RV_STATIC_INLINE static inline
+
+/* memory mapped structure for Program Fast Interrupt Controller (PFIC), V4 layout */
+typedef struct
+{
+    __I  uint32_t ISR[8];
+    __I  uint32_t IPR[8];
+    __IO uint32_t ITHRESDR;
+    __IO uint32_t RESERVED;
+    __IO uint32_t CFGR;
+    __I  uint32_t GISR;
+    __IO uint8_t  VTFIDR[4];
+    uint8_t       RESERVED0[12];
+    __IO uint32_t VTFADDR[4];
+    uint8_t       RESERVED1[0x90];
+    __O  uint32_t IENR[8];
+    uint8_t       RESERVED2[0x60];
+    __O  uint32_t IRER[8];
+    uint8_t       RESERVED3[0x60];
+    __O  uint32_t IPSR[8];
+    uint8_t       RESERVED4[0x60];
+    __O  uint32_t IPRR[8];
+    uint8_t       RESERVED5[0x60];
+    __IO uint32_t IACTR[8];
+    uint8_t       RESERVED6[0xE0];
+    __IO uint8_t  IPRIOR[256];
+    uint8_t       RESERVED7[0x810];
+    __IO uint32_t SCTLR;
+} PFIC_Type;
+
+/* memory mapped structure for SysTick */
+typedef struct
+{
+    __IO uint32_t CTLR;
+    __IO uint32_t SR;
+    __IO uint64_t CNT;
+    __IO uint64_t CMP;
+} SysTick_Type;
+
+#define PFIC      ((PFIC_Type *)0xE000E000)
+#define NVIC      PFIC
+#define NVIC_KEY1 ((uint32_t)0xFA050000)
+#define NVIC_KEY2 ((uint32_t)0xBCAF0000)
+#define NVIC_KEY3 ((uint32_t)0xBEEF0000)
+
+#define SysTick   ((SysTick_Type *)0xE000F000)
+
+/* CSRs, see host_shim.c */
+extern uint32_t host_shim_mstatus;
+
+uint32_t __get_FFLAGS(void);
+void     __set_FFLAGS(uint32_t value);
+uint32_t __get_FRM(void);
+void     __set_FRM(uint32_t value);
+uint32_t __get_FCSR(void);
+void     __set_FCSR(uint32_t value);
+uint32_t __get_MSTATUS(void);
+void     __set_MSTATUS(uint32_t value);
+uint32_t __get_MISA(void);
+void     __set_MISA(uint32_t value);
+uint32_t __get_MTVEC(void);
+void     __set_MTVEC(uint32_t value);
+uint32_t __get_MSCRATCH(void);
+void     __set_MSCRATCH(uint32_t value);
+uint32_t __get_MEPC(void);
+void     __set_MEPC(uint32_t value);
+uint32_t __get_MCAUSE(void);
+void     __set_MCAUSE(uint32_t value);
+uint32_t __get_MTVAL(void);
+void     __set_MTVAL(uint32_t value);
+uint32_t __get_MVENDORID(void);
+uint32_t __get_MARCHID(void);
+uint32_t __get_MIMPID(void);
+uint32_t __get_MHARTID(void);
+uint32_t __get_SP(void);
+uint32_t __get_DEBUG_CR(void);
+void     __set_DEBUG_CR(uint32_t value);
+
+RV_STATIC_INLINE void __enable_irq(void)
+{
+    host_shim_mstatus |= 0x88;
+}
+
+RV_STATIC_INLINE void __disable_irq(void)
+{
+    host_shim_mstatus &= ~0x88U;
+}
+
+RV_STATIC_INLINE void __NOP(void)
+{
+}
+
+RV_STATIC_INLINE void __WFI(void)
+{
+}
+
+RV_STATIC_INLINE void __WFE(void)
+{
+}
+
+RV_STATIC_INLINE void _SEV(void)
+{
+}
+
+RV_STATIC_INLINE void _WFE(void)
+{
+}
+
+RV_STATIC_INLINE void __SEV(void)
+{
+}
+
+/* IRQn is an int instead of IRQn_Type, the enum isn't declared yet in every series header */
+RV_STATIC_INLINE void NVIC_EnableIRQ(uint32_t IRQn)
+{
+    NVIC->IENR[IRQn >> 5] = 1U << (IRQn & 0x1F);
+}
+
+RV_STATIC_INLINE void NVIC_DisableIRQ(uint32_t IRQn)
+{
+    NVIC->IRER[IRQn >> 5] = 1U << (IRQn & 0x1F);
+}
+
+RV_STATIC_INLINE uint32_t NVIC_GetStatusIRQ(uint32_t IRQn)
+{
+    return (NVIC->ISR[IRQn >> 5] & (1U << (IRQn & 0x1F))) ? 1 : 0;
+}
+
+RV_STATIC_INLINE uint32_t NVIC_GetPendingIRQ(uint32_t IRQn)
+{
+    return (NVIC->IPR[IRQn >> 5] & (1U << (IRQn & 0x1F))) ? 1 : 0;
+}
+
+RV_STATIC_INLINE void NVIC_SetPendingIRQ(uint32_t IRQn)
+{
+    NVIC->IPSR[IRQn >> 5] = 1U << (IRQn & 0x1F);
+}
+
+RV_STATIC_INLINE void NVIC_ClearPendingIRQ(uint32_t IRQn)
+{
+    NVIC->IPRR[IRQn >> 5] = 1U << (IRQn & 0x1F);
+}
+
+RV_STATIC_INLINE uint32_t NVIC_GetActive(uint32_t IRQn)
+{
+    return (NVIC->IACTR[IRQn >> 5] & (1U << (IRQn & 0x1F))) ? 1 : 0;
+}
+
+RV_STATIC_INLINE void NVIC_SetPriority(uint32_t IRQn, uint8_t priority)
+{
+    NVIC->IPRIOR[IRQn] = priority;
+}
+
+RV_STATIC_INLINE void SetVTFIRQ(uint32_t addr, uint32_t IRQn, uint8_t num, FunctionalState NewState)
+{
+    if(num > 3)
+        return;
+    if(NewState != DISABLE)
+    {
+        NVIC->VTFIDR[num] = (uint8_t)IRQn;
+        NVIC->VTFADDR[num] = (addr & 0xFFFFFFFE) | 1;
+    }
+    else
+    {
+        NVIC->VTFIDR[num] = (uint8_t)IRQn;
+        NVIC->VTFADDR[num] = addr & 0xFFFFFFFE;
+    }
+}
+
+RV_STATIC_INLINE void NVIC_SystemReset(void)
+{
+    NVIC->CFGR = NVIC_KEY3 | (1 << 7);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_RISCV_H__ */
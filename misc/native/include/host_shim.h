@@ -0,0 +1,34 @@
+/*
+ * Test helpers of the host shim for native builds (see misc/native/native_env.py).
+ *
+ * The register blocks and the flash are backed by zero filled host memory at
+ * their real addresses. Tests can preset status registers or flash contents
+ * through the SDK structures (e.g. USART2->STATR = USART_FLAG_TC) and call
+ * host_shim_reset() in setUp() to start from a clean state.
+ */
+#ifndef __HOST_SHIM_H__
+#define __HOST_SHIM_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HOST_SHIM_FLASH_BASE 0x08000000UL
+#define HOST_SHIM_FLASH_SIZE 0x00100000UL
+
+/* time passed in Delay_Us() / Delay_Ms() since the last reset */
+extern uint64_t host_shim_elapsed_us;
+
+/* clears all register blocks, erases the flash (0xFF) and resets the CSRs */
+void host_shim_reset(void);
+
+/* monotonic host time for microbenchmarks */
+uint64_t host_shim_now_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_SHIM_H__ */
@@ -0,0 +1,111 @@
+# Pre extra script for building NoneOS SDK based code on the host (Linux), e.g.
+# for unit tests with "pio test -e native":
+#
+#   [env:native]
+#   platform = native
+#   framework =
+#   extra_scripts = pre:${platformio.platforms_dir}/ch32v/misc/native/native_env.py
+#   custom_ch32v_board = ch32v307_evt
+#
+# The series headers and peripheral drivers of the SDK are taken from the
+# framework-wch-noneos-sdk package, which is installed by building one of the
+# ch32v environments first. core_riscv.h, the delay functions and the system
+# code are replaced by the host shim in this directory.
+from os.path import isdir, isfile, join, dirname, realpath
+import inspect
+import json
+import sys
+
+Import("env")
+
+SHIM_DIR = dirname(realpath(inspect.currentframe().f_code.co_filename))
+PLATFORM_DIR = dirname(dirname(SHIM_DIR))
+
+def fail(message: str):
+    sys.stderr.write("Error: %s\n" % message)
+    env.Exit(1)
+
+board_id = env.GetProjectOption("custom_ch32v_board", "")
+if not board_id:
+    fail("custom_ch32v_board is not set, e.g. custom_ch32v_board = ch32v307_evt")
+board_file = join(PLATFORM_DIR, "boards", "%s.json" % board_id)
+if not isfile(board_file):
+    fail("unknown board %s (no %s)" % (board_id, board_file))
+with open(board_file) as fp:
+    board_build = json.load(fp).get("build", {})
+
+# same conversion as in builder/frameworks/noneos_sdk.py
+series = board_build.get("series", "")
+if series != "ch32x035":
+    series = series[0:-1].lower() + "x"
+
+FRAMEWORK_DIR = join(env.subst("$PROJECT_PACKAGES_DIR"), "framework-wch-noneos-sdk")
+if not isdir(join(FRAMEWORK_DIR, "Peripheral", series)):
+    fail("the NoneOS SDK for %s is not installed in %s, build one of the ch32v environments first" % (
+        series, FRAMEWORK_DIR))
+
+env.Append(**env.ParseFlags(board_build.get("extra_flags", "")))
+env.Append(
+    CPPDEFINES=["CH32V_HOST_SHIM"],
+    # the SDK casts register addresses from / to uint32_t, keep the program
+    # itself below 4G so that such casts of addresses of globals still work
+    CCFLAGS=["-fno-pie", "-Wno-int-to-pointer-cast", "-Wno-pointer-to-int-cast"],
+    LINKFLAGS=["-no-pie"]
+)
+# the shim goes first, its core_riscv.h replaces the one from Core/<series>
+env.Prepend(CPPPATH=[join(SHIM_DIR, "include")])
+env.Append(
+    CPPPATH=[
+        join(FRAMEWORK_DIR, "Peripheral", series, "inc"),
+        join(FRAMEWORK_DIR, "Peripheral", series, "src"),
+        join(FRAMEWORK_DIR, "System", series),
+        join(FRAMEWORK_DIR, "Debug", series)
+    ]
+)
+
+env.BuildSources(join("$BUILD_DIR", "HostShim"), join(SHIM_DIR, "src"))
+
+# same as board_build.web_assets_dir in builder/frameworks/_bare.py
+web_assets_dir = env.GetProjectOption("board_build.web_assets_dir", "")
+web_templates_dir = env.GetProjectOption("board_build.web_templates_dir", "")
+web_routes = env.GetProjectOption("board_build.web_routes", "")
+if web_assets_dir:
+    sys.path.insert(0, join(PLATFORM_DIR, "misc", "scripts"))
+    from gen_web_assets import generate as generate_web_assets
+    web_assets_src = join(env.subst("$BUILD_DIR"), "web_assets")
+    try:
+        generate_web_assets(
+            join(env.subst("$PROJECT_DIR"), web_assets_dir), web_assets_src,
+            join(env.subst("$PROJECT_DIR"), web_templates_dir) if web_templates_dir else None,
+            join(env.subst("$PROJECT_DIR"), web_routes) if web_routes else None)
+    except ValueError as e:
+        fail(str(e))
+    env.Append(CPPPATH=[web_assets_src])
+    # as a library, the route table refers to the POST handlers of lib/HTTP,
+    # which a test that doesn't use the web server doesn't build
+    env.Prepend(LIBS=[env.BuildLibrary(join("$BUILD_DIR", "WebAssets"), web_assets_src)])
+
+# same as board_build.wchnet_ram in builder/frameworks/_bare.py, so the
+# tests see the sizes of the firmware
+wchnet_options = ("tcp", "tcp_listen", "udp", "ipraw", "mss", "window", "txbufs")
+wchnet_ram = env.GetProjectOption("board_build.wchnet_ram", "")
+if wchnet_ram:
+    sys.path.insert(0, join(PLATFORM_DIR, "misc", "scripts"))
+    from gen_net_config import NetProfile, driver_from_defines, generate as generate_net_config, parse_size
+    wchnet_src = join(env.subst("$BUILD_DIR"), "wchnet_sizes")
+    try:
+        profile = NetProfile(parse_size(wchnet_ram),
+                             driver=driver_from_defines(env.ParseFlags(env.get("BUILD_FLAGS", []))["CPPDEFINES"]))
+        for option in wchnet_options:
+            value = env.GetProjectOption("board_build.wchnet_" + option, "")
+            if value:
+                setattr(profile, option, int(value))
+        generate_net_config(profile, wchnet_src)
+    except ValueError as e:
+        fail("board_build.wchnet_*: %s" % e)
+    env.Append(CPPPATH=[wchnet_src], CPPDEFINES=["WCHNET_AUTO_SIZE"])
+
+# as a library, so only the drivers that are used have to link on the host
+env.Prepend(LIBS=[
+    env.BuildLibrary(join("$BUILD_DIR", "HostSDKPeripheral"), join(FRAMEWORK_DIR, "Peripheral", series, "src"))
+])
@@ -0,0 +1,266 @@
+/*
+ * Host shim for native builds of NoneOS SDK based code (Linux only).
+ *
+ * Maps host memory at the addresses of the flash, the option bytes and the
+ * peripheral / core register blocks before main() runs, so register accesses
+ * through the SDK structures and flash reads work unchanged. Nothing behind
+ * the registers is emulated: a busy flag reads as whatever was written last.
+ *
+ * The delay and printf setup functions of the SDK Debug code are weak, a test
+ * can provide its own versions.
+ */
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "host_shim.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+typedef struct
+{
+    uintptr_t   base;
+    size_t      size;
+    const char *name;
+} host_region_t;
+
+static const host_region_t host_regions[] = {
+    {HOST_SHIM_FLASH_BASE, HOST_SHIM_FLASH_SIZE, "flash"},
+    {0x1FFF0000UL, 0x00010000UL, "system flash / option bytes"},
+    {0x40000000UL, 0x00100000UL, "APB / AHB peripherals"},
+    {0x50000000UL, 0x00100000UL, "USB / DVP"},
+    {0xA0000000UL, 0x00010000UL, "FSMC"},
+    {0xE0000000UL, 0x00100000UL, "PFIC / SysTick"},
+};
+
+uint64_t host_shim_elapsed_us;
+uint32_t host_shim_mstatus;
+
+static uint32_t host_csr_fcsr;
+static uint32_t host_csr_mtvec;
+static uint32_t host_csr_mscratch;
+static uint32_t host_csr_mepc;
+static uint32_t host_csr_mcause;
+static uint32_t host_csr_mtval;
+static uint32_t host_csr_debug_cr;
+
+uint32_t SystemCoreClock __attribute__((weak)) = 144000000;
+
+static void __attribute__((constructor(101))) host_shim_init(void)
+{
+    size_t i;
+
+    for(i = 0; i < sizeof(host_regions) / sizeof(host_regions[0]); i++)
+    {
+        void *addr = mmap((void *)host_regions[i].base, host_regions[i].size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+        if(addr != (void *)host_regions[i].base)
+        {
+            fprintf(stderr, "host_shim: cannot map the %s at 0x%08lx\n", host_regions[i].name,
+                    (unsigned long)host_regions[i].base);
+            abort();
+        }
+    }
+    host_shim_reset();
+}
+
+void host_shim_reset(void)
+{
+    size_t i;
+
+    for(i = 0; i < sizeof(host_regions) / sizeof(host_regions[0]); i++)
+        memset((void *)host_regions[i].base, 0, host_regions[i].size);
+    memset((void *)HOST_SHIM_FLASH_BASE, 0xFF, HOST_SHIM_FLASH_SIZE);
+    host_shim_elapsed_us = 0;
+    host_shim_mstatus = 0;
+    host_csr_fcsr = 0;
+    host_csr_mtvec = 0;
+    host_csr_mscratch = 0;
+    host_csr_mepc = 0;
+    host_csr_mcause = 0;
+    host_csr_mtval = 0;
+    host_csr_debug_cr = 0;
+}
+
+uint64_t host_shim_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* SDK Debug / System code */
+void __attribute__((weak)) Delay_Init(void)
+{
+}
+
+void __attribute__((weak)) Delay_Us(uint32_t n)
+{
+    host_shim_elapsed_us += n;
+}
+
+void __attribute__((weak)) Delay_Ms(uint32_t n)
+{
+    host_shim_elapsed_us += (uint64_t)n * 1000;
+}
+
+void __attribute__((weak)) USART_Printf_Init(uint32_t baudrate)
+{
+    (void)baudrate;
+}
+
+void __attribute__((weak)) SDI_Printf_Enable(void)
+{
+}
+
+void __attribute__((weak)) SystemInit(void)
+{
+}
+
+void __attribute__((weak)) SystemCoreClockUpdate(void)
+{
+}
+
+/* CSRs */
+uint32_t __get_FFLAGS(void)
+{
+    return host_csr_fcsr & 0x1F;
+}
+
+void __set_FFLAGS(uint32_t value)
+{
+    host_csr_fcsr = (host_csr_fcsr & ~0x1FU) | (value & 0x1F);
+}
+
+uint32_t __get_FRM(void)
+{
+    return (host_csr_fcsr >> 5) & 0x7;
+}
+
+void __set_FRM(uint32_t value)
+{
+    host_csr_fcsr = (host_csr_fcsr & ~0xE0U) | ((value & 0x7) << 5);
+}
+
+uint32_t __get_FCSR(void)
+{
+    return host_csr_fcsr;
+}
+
+void __set_FCSR(uint32_t value)
+{
+    host_csr_fcsr = value & 0xFF;
+}
+
+uint32_t __get_MSTATUS(void)
+{
+    return host_shim_mstatus;
+}
+
+void __set_MSTATUS(uint32_t value)
+{
+    host_shim_mstatus = value;
+}
+
+uint32_t __get_MISA(void)
+{
+    /* RV32IMAFC */
+    return 0x40001125;
+}
+
+void __set_MISA(uint32_t value)
+{
+    (void)value;
+}
+
+uint32_t __get_MTVEC(void)
+{
+    return host_csr_mtvec;
+}
+
+void __set_MTVEC(uint32_t value)
+{
+    host_csr_mtvec = value;
+}
+
+uint32_t __get_MSCRATCH(void)
+{
+    return host_csr_mscratch;
+}
+
+void __set_MSCRATCH(uint32_t value)
+{
+    host_csr_mscratch = value;
+}
+
+uint32_t __get_MEPC(void)
+{
+    return host_csr_mepc;
+}
+
+void __set_MEPC(uint32_t value)
+{
+    host_csr_mepc = value;
+}
+
+uint32_t __get_MCAUSE(void)
+{
+    return host_csr_mcause;
+}
+
+void __set_MCAUSE(uint32_t value)
+{
+    host_csr_mcause = value;
+}
+
+uint32_t __get_MTVAL(void)
+{
+    return host_csr_mtval;
+}
+
+void __set_MTVAL(uint32_t value)
+{
+    host_csr_mtval = value;
+}
+
+uint32_t __get_MVENDORID(void)
+{
+    return 0;
+}
+
+uint32_t __get_MARCHID(void)
+{
+    return 0;
+}
+
+uint32_t __get_MIMPID(void)
+{
+    return 0;
+}
+
+uint32_t __get_MHARTID(void)
+{
+    return 0;
+}
+
+uint32_t __get_SP(void)
+{
+    return (uint32_t)(uintptr_t)__builtin_frame_address(0);
+}
+
+uint32_t __get_DEBUG_CR(void)
+{
+    return host_csr_debug_cr;
+}
+
+void __set_DEBUG_CR(uint32_t value)
+{
+    host_csr_debug_cr = value;
+}
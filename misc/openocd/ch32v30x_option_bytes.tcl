@@ -0,0 +1,59 @@
+# Option byte helpers for CH32V303xC / CH32V305 / CH32V307.
+# Used by the builder to program the SRAM_CODE_MODE bits (SRAM / flash split)
+# before uploading, see board_build.ram_flash_split.
+
+set CH32V_FLASH_KEYR   0x40022004
+set CH32V_FLASH_OBKEYR 0x40022008
+set CH32V_FLASH_STATR  0x4002200C
+set CH32V_FLASH_CTLR   0x40022010
+set CH32V_OB_BASE      0x1FFFF800
+
+proc ch32v30x_wait_flash_idle {} {
+    global CH32V_FLASH_STATR
+    for {set i 0} {$i < 1000} {incr i} {
+        mem2array statr 32 $CH32V_FLASH_STATR 1
+        if {($statr(0) & 0x1) == 0} {
+            return
+        }
+    }
+    error "timeout waiting for the flash controller"
+}
+
+proc ch32v30x_set_sram_code_mode {mode} {
+    global CH32V_FLASH_KEYR CH32V_FLASH_OBKEYR CH32V_FLASH_CTLR CH32V_OB_BASE
+
+    # RDPR, USER, DATA0, DATA1, WRPR0..3 (each followed by its complement)
+    mem2array ob 16 $CH32V_OB_BASE 8
+    set user [expr {$ob(1) & 0xFF}]
+    set current [expr {($user >> 6) & 0x3}]
+    if {$current == $mode} {
+        echo "SRAM_CODE_MODE already set to $mode"
+        return
+    }
+    echo "Changing SRAM_CODE_MODE from $current to $mode"
+    set ob(1) [expr {($user & 0x3F) | ($mode << 6)}]
+
+    # unlock flash and option byte programming
+    mww $CH32V_FLASH_KEYR 0x45670123
+    mww $CH32V_FLASH_KEYR 0xCDEF89AB
+    mww $CH32V_FLASH_OBKEYR 0x45670123
+    mww $CH32V_FLASH_OBKEYR 0xCDEF89AB
+
+    # erase the option bytes (OBER + STRT)
+    mmw $CH32V_FLASH_CTLR 0x20 0
+    mmw $CH32V_FLASH_CTLR 0x40 0
+    ch32v30x_wait_flash_idle
+    mmw $CH32V_FLASH_CTLR 0 0x20
+
+    # write them back, the complements are generated by the hardware (OBPG)
+    mmw $CH32V_FLASH_CTLR 0x10 0
+    for {set i 0} {$i < 8} {incr i} {
+        mwh [expr {$CH32V_OB_BASE + 2 * $i}] [expr {$ob($i) & 0xFF}]
+        ch32v30x_wait_flash_idle
+    }
+    mmw $CH32V_FLASH_CTLR 0 0x10
+
+    # lock again (LOCK)
+    mmw $CH32V_FLASH_CTLR 0x80 0
+    echo "SRAM_CODE_MODE changed, it takes effect after the next reset"
+}
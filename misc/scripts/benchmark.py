@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# Builds the benchmark firmware from misc/benchmark (plus the kernels in
+# <project>/benchmark/*.c) for the board's -march / -mabi, runs it on the
+# QEMU "virt" machine (or any other emulator given with --emulator) and
+# collects the mcycle / minstret counts of every kernel. The results can be
+# written as JSON and compared against a saved baseline.
+from typing import Dict
+from pathlib import Path
+import argparse
+import glob
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+BENCH_DIR = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "benchmark")
+
+DEFAULT_EMULATOR = "qemu-system-riscv32 -M virt -bios none -nographic -icount shift=0 -cpu {cpu} -kernel {elf}"
+
+def get_emulator_march(march: str) -> str:
+    # vendor extensions (WCH "xw") can't be emulated, build without them
+    base, _, rest = march.partition("_")
+    base = re.sub(r"x\w*$", "", base)
+    extensions = [e for e in rest.split("_") if e and not e.startswith("x")]
+    return "_".join([base] + extensions)
+
+def get_qemu_cpu(march: str) -> str:
+    letters = march.partition("_")[0][4:].replace("g", "imafd")
+    props = ["rv32"]
+    if "e" in letters:
+        props += ["e=true", "i=false"]
+    for ext in "mafdc":
+        props.append("%s=%s" % (ext, "true" if ext in letters else "false"))
+    return ",".join(props)
+
+def build(args, elf: str) -> bool:
+    sources = sorted(glob.glob(os.path.join(BENCH_DIR, "*.c")) + glob.glob(os.path.join(BENCH_DIR, "*.S")))
+    if args.project_benchmarks and os.path.isdir(args.project_benchmarks):
+        sources += sorted(glob.glob(os.path.join(args.project_benchmarks, "*.c")))
+    cmd = [args.cc, "-march=%s" % args.march, "-mabi=%s" % args.mabi,
+           args.optimization, "-g", "-ffunction-sections", "-fdata-sections",
+           "-I", BENCH_DIR, "-T", os.path.join(BENCH_DIR, "qemu_virt.ld"),
+           "-nostartfiles", "--specs=nano.specs", "--specs=nosys.specs",
+           "-Wl,--gc-sections", "-o", elf] + sources + ["-lm"]
+    if args.verbose:
+        print(" ".join(shlex.quote(c) for c in cmd))
+    try:
+        proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    except OSError as exc:
+        print("Error: failed to run the compiler %s: %s" % (args.cc, exc))
+        return False
+    if proc.returncode != 0:
+        print(proc.stdout)
+        print("Error: failed to build the benchmark firmware")
+        return False
+    return True
+
+def run(args, elf: str) -> Dict[str, dict]:
+    cmd = [part.format(elf=elf, cpu=get_qemu_cpu(args.march)) for part in shlex.split(args.emulator)]
+    if args.verbose:
+        print(" ".join(shlex.quote(c) for c in cmd))
+    try:
+        proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True,
+                              timeout=args.timeout)
+        output = proc.stdout
+    except subprocess.TimeoutExpired as exc:
+        output = exc.stdout.decode(errors="replace") if isinstance(exc.stdout, bytes) else (exc.stdout or "")
+        output += "\nBENCH_ERROR timeout after %d seconds\n" % args.timeout
+    except OSError as exc:
+        raise RuntimeError("failed to run the emulator %s: %s" % (cmd[0], exc))
+    results = {}
+    for line in output.splitlines():
+        m = re.match(r"^BENCH (\S+) (\d+) (\d+) (\d+)\s*$", line)
+        if m:
+            iterations, cycles, instret = int(m.group(2)), int(m.group(3)), int(m.group(4))
+            results[m.group(1)] = {
+                "iterations": iterations,
+                "cycles": cycles,
+                "instret": instret,
+                "cycles_per_iteration": cycles / max(iterations, 1),
+                "instret_per_iteration": instret / max(iterations, 1),
+            }
+        elif line.startswith("BENCH_ERROR"):
+            raise RuntimeError(line[len("BENCH_ERROR "):])
+    if "BENCH_DONE" not in output:
+        print(output)
+        raise RuntimeError("the benchmark firmware did not finish")
+    return results
+
+def print_results(results: Dict[str, dict], baseline: Dict[str, dict]):
+    width = max(len("Kernel"), max(len(k) for k in results))
+    print("%-*s %10s %14s %14s %9s" % (width, "Kernel", "Iterations", "Cycles/iter", "Instret/iter", "Change"))
+    for name, res in results.items():
+        change = ""
+        if name in baseline and baseline[name]["cycles_per_iteration"]:
+            old = baseline[name]["cycles_per_iteration"]
+            change = "%+.1f%%" % (100.0 * (res["cycles_per_iteration"] - old) / old)
+        print("%-*s %10d %14.1f %14.1f %9s" % (width, name, res["iterations"], res["cycles_per_iteration"],
+                                              res["instret_per_iteration"], change))
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the benchmark kernels under an emulator")
+    parser.add_argument("--cc", required=True, help="RISC-V GCC")
+    parser.add_argument("--march", required=True)
+    parser.add_argument("--mabi", required=True)
+    parser.add_argument("--optimization", default="-Os")
+    parser.add_argument("--project-benchmarks", help="directory with additional kernels")
+    parser.add_argument("--build-dir", required=True)
+    parser.add_argument("--emulator", default=DEFAULT_EMULATOR,
+                        help="emulator command line, {elf} and {cpu} are replaced")
+    parser.add_argument("--timeout", type=int, default=120)
+    parser.add_argument("--json", dest="json_file", help="write the results to this JSON file")
+    parser.add_argument("--baseline", help="JSON results to compare against")
+    parser.add_argument("--save-baseline", action="store_true", help="store the results as new baseline")
+    parser.add_argument("--max-regression", type=float, default=-1,
+                        help="fail if a kernel needs this many percent more cycles than in the baseline")
+    parser.add_argument("--verbose", action="store_true")
+    args = parser.parse_args()
+
+    board_march = args.march
+    args.march = get_emulator_march(args.march)
+    if args.march != board_march:
+        print("Building for %s instead of %s, the emulator doesn't know the vendor extensions" % (
+            args.march, board_march))
+    os.makedirs(args.build_dir, exist_ok=True)
+    elf = os.path.join(args.build_dir, "benchmark.elf")
+    if not build(args, elf):
+        return 1
+    try:
+        results = run(args, elf)
+    except RuntimeError as exc:
+        print("Error: %s" % exc)
+        return 1
+    if not results:
+        print("Error: no benchmark results")
+        return 1
+
+    report = {"march": args.march, "mabi": args.mabi, "optimization": args.optimization,
+              "emulator": args.emulator, "benchmarks": results}
+    baseline = {}
+    if args.baseline and not args.save_baseline and os.path.isfile(args.baseline):
+        baseline = json.loads(Path(args.baseline).read_text(encoding="utf-8")).get("benchmarks", {})
+    print_results(results, baseline)
+    if args.json_file:
+        Path(args.json_file).write_text(json.dumps(report, indent=2), encoding="utf-8")
+        print("Results written to %s" % args.json_file)
+    if args.baseline:
+        if args.save_baseline:
+            os.makedirs(os.path.dirname(os.path.abspath(args.baseline)), exist_ok=True)
+            Path(args.baseline).write_text(json.dumps(report, indent=2), encoding="utf-8")
+            print("Baseline saved to %s" % args.baseline)
+        elif not baseline:
+            print("No baseline found at %s (save one with the benchmark_save target)" % args.baseline)
+        elif args.max_regression >= 0:
+            slower = [name for name, res in results.items() if name in baseline and
+                      res["cycles_per_iteration"] > baseline[name]["cycles_per_iteration"] *
+                      (1 + args.max_regression / 100.0)]
+            if slower:
+                print("Error: %s regressed by more than %.1f%%" % (", ".join(slower), args.max_regression))
+                return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
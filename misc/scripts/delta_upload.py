@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+# Delta upload: remembers the last image written to every device (keyed by
+# the chip's unique ID) and only erases / writes the flash sectors that
+# changed since then. Falls back to programming the full image if there is
+# no cached image for the device, the device can't be identified, or the
+# delta write doesn't verify (OpenOCD verifies the image, the ranges written
+# by minichlink are read back and compared).
+#
+#   delta_upload.py --tool openocd --image firmware.bin --fallback firmware.elf \
+#       --cache-dir DIR -- openocd -f wch-riscv.cfg -c init -c halt
+#
+# Everything after "--" is the tool's base command line; the commands for
+# reading the ID and writing the sectors are appended to it.
+from typing import List, Optional, Tuple
+from pathlib import Path
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+DELTA_FAILED = "Delta upload failed"
+
+def tcl_path(path: str) -> str:
+    # OpenOCD wants forward slashes, also on Windows
+    return "{%s}" % Path(path).as_posix()
+
+def run(cmd: List[str]) -> Tuple[int, str]:
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    return proc.returncode, proc.stdout
+
+def run_shown(cmd: List[str]) -> Tuple[int, str]:
+    """As run(), but the output is also shown while the tool runs."""
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    out = []
+    for line in proc.stdout:
+        sys.stdout.write(line)
+        sys.stdout.flush()
+        out.append(line)
+    return proc.wait(), "".join(out)
+
+def read_device_id(args) -> Optional[str]:
+    if args.tool == "openocd":
+        cmd = args.base_cmd + ["-c", "mdw %s 3" % args.uid_address, "-c", "shutdown"]
+        code, out = run(cmd)
+        m = re.search(r"0x%x:\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{8})"
+                      % int(args.uid_address, 0), out, re.IGNORECASE)
+    else:
+        code, out = run(args.base_cmd + ["-i"])
+        m = re.search(r"UUID\s*:\s*([0-9a-fA-F][0-9a-fA-F-]+)", out, re.IGNORECASE)
+    if code != 0 or not m:
+        if args.verbose:
+            print(out)
+        return None
+    return "".join(m.groups()).replace("-", "").lower()
+
+def changed_ranges(old: bytes, new: bytes, page_size: int) -> List[Tuple[int, int]]:
+    """Returns (offset, length) of the runs of changed pages of the new image."""
+    ranges: List[Tuple[int, int]] = []
+    for offset in range(0, len(new), page_size):
+        if new[offset:offset + page_size] == old[offset:offset + page_size]:
+            continue
+        length = min(page_size, len(new) - offset)
+        if ranges and ranges[-1][0] + ranges[-1][1] == offset:
+            ranges[-1] = (ranges[-1][0], ranges[-1][1] + length)
+        else:
+            ranges.append((offset, length))
+    return ranges
+
+def full_upload(args) -> int:
+    if args.tool == "openocd":
+        cmd = args.base_cmd + ["-c", "program %s verify reset" % tcl_path(args.fallback),
+                               "-c", "shutdown"]
+    else:
+        cmd = args.base_cmd + ["-w", args.image, "0x%08x" % args.address, "-b"]
+    return subprocess.call(cmd)
+
+def delta_upload_openocd(args, image: bytes, ranges: List[Tuple[int, int]], tmp_dir: str) -> Tuple[int, bool]:
+    """Returns the exit code and whether the full image was programmed instead."""
+    script = ["proc delta_program {} {"]
+    for i, (offset, length) in enumerate(ranges):
+        part = os.path.join(tmp_dir, "part%d.bin" % i)
+        Path(part).write_bytes(image[offset:offset + length])
+        # the ranges are page aligned, so erasing them doesn't touch anything else
+        script.append("    flash write_image erase %s 0x%08x bin" % (tcl_path(part), args.address + offset))
+    script.append("    verify_image %s 0x%08x bin" % (tcl_path(args.image), args.address))
+    script.append("}")
+    script.append("if {[catch {delta_program} err]} {")
+    script.append("    echo \"%s ($err), programming the full image\"" % DELTA_FAILED)
+    script.append("    program %s verify" % tcl_path(args.fallback))
+    script.append("}")
+    script.append("reset run")
+    script.append("shutdown")
+    script_file = os.path.join(tmp_dir, "delta_upload.tcl")
+    Path(script_file).write_text("\n".join(script) + "\n", encoding="utf-8")
+    code, out = run_shown(args.base_cmd + ["-f", Path(script_file).as_posix()])
+    return code, DELTA_FAILED in out
+
+def delta_upload_minichlink(args, image: bytes, ranges: List[Tuple[int, int]], tmp_dir: str) -> Tuple[int, bool]:
+    """Returns the exit code and whether the full image was programmed instead."""
+    write_cmd = list(args.base_cmd)
+    read_cmd = list(args.base_cmd)
+    for i, (offset, length) in enumerate(ranges):
+        part = os.path.join(tmp_dir, "part%d.bin" % i)
+        Path(part).write_bytes(image[offset:offset + length])
+        write_cmd += ["-w", part, "0x%08x" % (args.address + offset)]
+        read_cmd += ["-r", part + ".read", "0x%08x" % (args.address + offset), str(length)]
+    if subprocess.call(write_cmd) == 0 and subprocess.call(read_cmd) == 0:
+        # minichlink doesn't verify, compare what the flash holds now
+        for i, (offset, length) in enumerate(ranges):
+            read_back = os.path.join(tmp_dir, "part%d.bin.read" % i)
+            if not os.path.isfile(read_back) or \
+                    Path(read_back).read_bytes()[:length] != image[offset:offset + length]:
+                print("%s (range at 0x%08x doesn't verify), programming the full image" % (
+                    DELTA_FAILED, args.address + offset))
+                return full_upload(args), True
+        return subprocess.call(args.base_cmd + ["-b"]), False
+    print("%s, programming the full image" % DELTA_FAILED)
+    return full_upload(args), True
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload only the flash pages that changed")
+    parser.add_argument("--tool", choices=("openocd", "minichlink"), required=True)
+    parser.add_argument("--image", required=True, help="raw binary of the firmware")
+    parser.add_argument("--fallback", help="image for a full upload (default: --image)")
+    parser.add_argument("--address", type=lambda x: int(x, 0), default=0x08000000,
+                        help="flash address of the image, upload.offset_address")
+    parser.add_argument("--page-size", type=int, default=4096,
+                        help="erase granularity, must be a multiple of the flash sector size")
+    parser.add_argument("--uid-address", default="0x1FFFF7E8", help="address of the 96-bit unique ID")
+    parser.add_argument("--cache-dir", required=True)
+    parser.add_argument("--verbose", action="store_true")
+    parser.add_argument("base_cmd", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+    if args.base_cmd and args.base_cmd[0] == "--":
+        args.base_cmd = args.base_cmd[1:]
+    if not args.base_cmd:
+        parser.error("missing tool command line after --")
+    args.fallback = args.fallback or args.image
+
+    image = Path(args.image).read_bytes()
+    start = time.time()
+    device_id = read_device_id(args)
+    cached = Path(args.cache_dir, "%s.bin" % device_id) if device_id else None
+    if device_id is None:
+        print("Delta upload: could not read the device ID, programming the full image")
+    elif not cached.is_file():
+        print("Delta upload: no previous image for device %s, programming the full image" % device_id)
+    if cached is None or not cached.is_file():
+        result = full_upload(args)
+        written = len(image)
+    else:
+        ranges = changed_ranges(cached.read_bytes(), image, args.page_size)
+        written = sum(length for _, length in ranges)
+        if not ranges:
+            print("Delta upload: device %s already has this image, resetting it" % device_id)
+            if args.tool == "openocd":
+                result = subprocess.call(args.base_cmd + ["-c", "reset run", "-c", "shutdown"])
+            else:
+                result = subprocess.call(args.base_cmd + ["-b"])
+        else:
+            print("Delta upload: %d of %d bytes changed in %d range(s) on device %s" % (
+                written, len(image), len(ranges), device_id))
+            with tempfile.TemporaryDirectory() as tmp_dir:
+                if args.tool == "openocd":
+                    result, full = delta_upload_openocd(args, image, ranges, tmp_dir)
+                else:
+                    result, full = delta_upload_minichlink(args, image, ranges, tmp_dir)
+            if full:
+                written = len(image)
+    if result != 0:
+        # the flash content is unknown now, the next upload has to be a full one
+        if cached is not None and cached.is_file():
+            cached.unlink()
+        print("Error: upload failed (exit code %d)" % result)
+        return result
+    if cached is not None:
+        os.makedirs(args.cache_dir, exist_ok=True)
+        tmp_file = str(cached) + ".tmp"
+        shutil.copyfile(args.image, tmp_file)
+        os.replace(tmp_file, cached)
+    print("Delta upload: wrote %d bytes, skipped %d bytes (%.0f%%) in %.1fs" % (
+        written, len(image) - written, 100.0 * (len(image) - written) / max(len(image), 1),
+        time.time() - start))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -47,7 +47,8 @@ class ChipInfo:
 
     def get_riscv_arch_and_abi(self) -> Tuple[str, str]:
         # ch32v30x is capable of rv32imafcxw
-        # but SDK uses rv32imacxw (no floating point)
+        # but SDK uses rv32imacxw (no floating point) by default,
+        # see get_riscv_fpu_arch_and_abi()
         # ch32v208 is rv32imacxw (QingKe V4C)
         # other ch32v20x is rv32imacxw (QingKe V4B)
         # ch32v10x only rv32imac (RISC-V3A)
@@ -71,6 +72,13 @@ class ChipInfo:
             exit(-1)
             return ("unknown", "unknown")
 
+    def get_riscv_fpu_arch_and_abi(self) -> Optional[Tuple[str, str]]:
+        # opt-in hardware floating point (board_build.fpu = yes),
+        # ch32v30x is QingKe V4F with a single precision FPU
+        if self.name.lower().startswith("ch32v3"):
+            return ("rv32imafcxw", "ilp32f")
+        return None
+
     def chip_without_package(self) -> str:
         return self.name[:-2]
 
@@ -302,6 +310,9 @@ def create_board_json(info: ChipInfo, board_name:str, output_path: str, patch_in
         # experiment
         base_json["frameworks"].append("zephyr")
         base_json["build"]["zephyr"] = {"variant": "usb_pdmon"}
+    fpu_arch_abi = info.get_riscv_fpu_arch_and_abi()
+    if fpu_arch_abi is not None:
+        base_json["build"]["march_fpu"], base_json["build"]["mabi_fpu"] = fpu_arch_abi
     add_openwch_arduino_info(base_json, patch_info, info, board_name)
 
     # add some classification macros
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+# Sizes the memory of the WCHNET Ethernet library from a target profile
+# (sockets, MSS, desired TCP window, RAM budget) and writes the result as
+# wchnet_sizes.h, which net_config.h of the project includes when
+# WCHNET_AUTO_SIZE is defined. Prints how much RAM the library, the
+# Ethernet driver and the socket receive buffers take.
+#
+# The TCP window is a whole number of segments. Each TCP connection can
+# have one window in flight (WCHNET_NUM_TCP_SEG), receive one window
+# (RECE_BUF_LEN) and the DMA can take one window back to back
+# (ETH_RXBUFNB). WCHNET builds each frame it sends in the buffer of a
+# send descriptor (ETH_TXBUFNB x ETH_TX_BUF_SZE). If that does not fit the
+# RAM budget, the window is made smaller, one segment at a time, so the
+# build gets the largest window that fits.
+#
+# The MSS defaults to the one net_config_defaults.h uses for the Ethernet
+# driver (ETH_DRIVER in build_flags): 800 for the internal 10M PHY, 1460
+# with an external PHY.
+#
+# The sizes follow net_config_defaults.h / wchnet.h / eth_driver_*.c in
+# lib/NetLib of the webserver-ch32v307-none-os example;
+# net_config_defaults.h checks the result again when it is compiled.
+#
+# Used by _bare.py (board_build.wchnet_ram and the other
+# board_build.wchnet_* options) and misc/native/native_env.py, but can also
+# be run by hand:
+#   gen_net_config.py output_dir --ram 48K [--driver ETH_DRIVER_RMII] [--tcp 3] [--window 5840]
+from dataclasses import dataclass, replace
+from pathlib import Path
+from typing import List, Optional, Sequence, Tuple
+import argparse
+import sys
+
+# wchnet.h
+MEM_ALIGNMENT = 4
+SIZE_IPRAW_PCB = 0x1C
+SIZE_UDP_PCB = 0x20
+SIZE_TCP_PCB = 0xB4
+SIZE_TCP_PCB_LISTEN = 0x24
+SIZE_PBUF = 0x10
+SIZE_TCP_SEG = 0x14
+SIZE_MEM = 0x08
+SIZE_ARP_TABLE = 0x18
+SIZE_SOCK_INF = 60
+MAX_SOCKETS = 31
+# net_config_defaults.h
+ETH_RX_BUF_SZE = 1520
+ETH_TX_BUF_SZE = 1520
+NUM_ARP_TABLE = 50
+ETH_TXBUFNB = 4
+# ETH_DRIVER -> WCHNET_TCP_MSS
+ETH_DRIVERS = {"ETH_DRIVER_10M": 800, "ETH_DRIVER_MII": 1460, "ETH_DRIVER_RMII": 1460, "ETH_DRIVER_RGMII": 1460}
+# ch32v30x_eth.h
+SIZE_DMA_DESC = 16
+
+@dataclass
+class NetProfile:
+    ram: int                        # budget in bytes
+    tcp: int = 3                    # WCHNET_NUM_TCP
+    tcp_listen: int = 3
+    udp: int = 1
+    ipraw: int = 1
+    mss: Optional[int] = None       # default from the driver
+    window: Optional[int] = None    # desired TCP window, default 4 segments
+    txbufs: int = ETH_TXBUFNB       # ETH_TXBUFNB
+    driver: str = "ETH_DRIVER_10M"
+
+    @property
+    def sockets(self) -> int:
+        return self.tcp + self.tcp_listen + self.udp + self.ipraw
+
+@dataclass
+class NetSizes:
+    profile: NetProfile
+    window_segs: int
+    rece_buf_len: int
+    num_tcp_seg: int
+    num_pool_buf: int
+    eth_rxbufnb: int
+    eth_txbufnb: int
+    ram: List[Tuple[str, int]]      # (what, bytes)
+
+    @property
+    def total(self) -> int:
+        return sum(size for _, size in self.ram)
+
+def parse_size(text: str) -> int:
+    """'40K' / '40960' -> bytes"""
+    text = str(text).strip().upper()
+    try:
+        if text.endswith("K"):
+            return int(text[:-1]) * 1024
+        return int(text)
+    except ValueError:
+        raise ValueError("%s is not a size, e.g. 40K or 40960" % text)
+
+def driver_from_defines(defines: Sequence) -> str:
+    """ETH_DRIVER from the CPPDEFINES of env.ParseFlags(), as
+    net_config_defaults.h defaults to the internal 10M PHY."""
+    for define in defines:
+        if isinstance(define, (list, tuple)) and define[0] == "ETH_DRIVER" and len(define) > 1:
+            value = str(define[1])
+            if value.isdigit() and int(value) < len(ETH_DRIVERS):
+                return list(ETH_DRIVERS)[int(value)]
+            if value not in ETH_DRIVERS:
+                raise ValueError("ETH_DRIVER %s is not one of %s" % (value, ", ".join(ETH_DRIVERS)))
+            return value
+    return "ETH_DRIVER_10M"
+
+def _align(size: int) -> int:
+    return (size + MEM_ALIGNMENT - 1) & ~(MEM_ALIGNMENT - 1)
+
+def check(profile: NetProfile):
+    """The checks of net_config_defaults.h, raises ValueError."""
+    if profile.driver not in ETH_DRIVERS:
+        raise ValueError("driver %s is not one of %s" % (profile.driver, ", ".join(ETH_DRIVERS)))
+    if not 60 <= profile.mss <= 1460:
+        raise ValueError("MSS %d must be 60 .. 1460" % profile.mss)
+    if min(profile.tcp, profile.tcp_listen, profile.udp, profile.ipraw) < 0:
+        raise ValueError("socket numbers must not be negative")
+    if profile.tcp_listen and not profile.tcp:
+        raise ValueError("TCP listen sockets need at least one TCP connection")
+    if not 1 <= profile.sockets <= MAX_SOCKETS:
+        raise ValueError("%d sockets, must be 1 .. %d" % (profile.sockets, MAX_SOCKETS))
+    if profile.window is not None and profile.window < profile.mss:
+        raise ValueError("window %d is smaller than the MSS %d" % (profile.window, profile.mss))
+    if profile.txbufs < 1:
+        raise ValueError("%d send descriptors, at least one is needed" % profile.txbufs)
+
+def size_for(profile: NetProfile, window_segs: int) -> NetSizes:
+    """Sizes of one window, without the budget check."""
+    mss = profile.mss
+    rece_buf_len = window_segs * mss
+    num_tcp_seg = max(profile.tcp * window_segs, 1)
+    num_pool_buf = profile.tcp * 2 + 2
+    size_pool_buf = (mss + 40 + 14 + 4 + 3) & ~3
+    while num_pool_buf * size_pool_buf < ETH_RX_BUF_SZE:   # a full frame has to fit
+        num_pool_buf += 1
+    eth_rxbufnb = max(window_segs + 2, 4)
+    eth_txbufnb = profile.txbufs
+
+    memp = ((MEM_ALIGNMENT - 1) +
+            profile.ipraw * _align(SIZE_IPRAW_PCB) +
+            profile.udp * _align(SIZE_UDP_PCB) +
+            profile.tcp * _align(SIZE_TCP_PCB) +
+            profile.tcp_listen * _align(SIZE_TCP_PCB_LISTEN) +
+            num_tcp_seg * _align(SIZE_TCP_SEG) +
+            num_pool_buf * _align(SIZE_PBUF) +             # WCHNET_NUM_PBUF
+            num_pool_buf * (_align(SIZE_PBUF) + _align(size_pool_buf)))
+    heap = (mss + 0x10 + 54 + 8) * num_tcp_seg + ETH_TX_BUF_SZE + 64 + 2 * 0x18
+    ram = [
+        ("Memp_Memory", memp),
+        ("Mem_Heap_Memory", _align(heap) + _align(SIZE_MEM)),
+        ("Mem_ArpTable", _align(SIZE_ARP_TABLE) * NUM_ARP_TABLE),
+        ("SocketInf", SIZE_SOCK_INF * profile.sockets),
+        ("MACRxBuf", eth_rxbufnb * ETH_RX_BUF_SZE),
+        ("MACTxBuf", eth_txbufnb * ETH_TX_BUF_SZE),
+        ("DMA descriptors", (eth_rxbufnb + eth_txbufnb) * SIZE_DMA_DESC),
+        ("SocketRecvBuf", profile.sockets * rece_buf_len),
+    ]
+    return NetSizes(profile, window_segs, rece_buf_len, num_tcp_seg, num_pool_buf,
+                    eth_rxbufnb, eth_txbufnb, ram)
+
+def size(profile: NetProfile) -> NetSizes:
+    """The largest window up to the desired one that fits the budget.
+    Raises ValueError if not even one segment fits."""
+    if profile.mss is None and profile.driver in ETH_DRIVERS:
+        profile = replace(profile, mss=ETH_DRIVERS[profile.driver])
+    check(profile)
+    window = profile.window if profile.window is not None else 4 * profile.mss
+    for window_segs in range(window // profile.mss, 0, -1):
+        sizes = size_for(profile, window_segs)
+        if sizes.total <= profile.ram:
+            return sizes
+    raise ValueError("the network buffers need %d bytes even with a window of one segment, "
+                     "the budget is %d\n%s" % (sizes.total, profile.ram, report(sizes)))
+
+def generate_h(sizes: NetSizes) -> str:
+    p = sizes.profile
+    defines = [
+        ("WCHNET_NUM_IPRAW", p.ipraw, "Number of IPRAW connections"),
+        ("WCHNET_NUM_UDP", p.udp, "The number of UDP connections"),
+        ("WCHNET_NUM_TCP", p.tcp, "Number of TCP connections"),
+        ("WCHNET_NUM_TCP_LISTEN", p.tcp_listen, "Number of TCP listening"),
+        ("WCHNET_TCP_MSS", p.mss, "Size of TCP MSS"),
+        ("RECE_BUF_LEN", sizes.rece_buf_len, "socket receive buffer size, %d x MSS" % sizes.window_segs),
+        ("WCHNET_NUM_TCP_SEG", sizes.num_tcp_seg, "The number of TCP segments used to send"),
+        ("WCHNET_NUM_POOL_BUF", sizes.num_pool_buf, "The number of POOL BUFs, the number of receive queues"),
+        ("ETH_TXBUFNB", sizes.eth_txbufnb, "The number of descriptors sent by the MAC"),
+        ("ETH_RXBUFNB", sizes.eth_rxbufnb, "Number of MAC received descriptors"),
+    ]
+    out = [
+        "/* Generated by gen_net_config.py for a RAM budget of %d bytes, do not edit */" % p.ram,
+        "#ifndef __WCHNET_SIZES_H__",
+        "#define __WCHNET_SIZES_H__",
+        "",
+    ]
+    for name, value, comment in defines:
+        out.append("#define %-29s %-6d /* %s */" % (name, value, comment))
+    out += ["", "#endif"]
+    return "\n".join(out) + "\n"
+
+def report(sizes: NetSizes) -> str:
+    p = sizes.profile
+    out = ["WCHNET memory, %d TCP connections, %d sockets, TCP window %d (%d x MSS %d):" % (
+        p.tcp, p.sockets, sizes.rece_buf_len, sizes.window_segs, p.mss)]
+    for what, size in sizes.ram:
+        out.append("  %-16s %7d" % (what, size))
+    out.append("  %-16s %7d of %d (%.0f%%)" % ("total", sizes.total, p.ram, 100.0 * sizes.total / p.ram))
+    return "\n".join(out)
+
+def _write_if_changed(path: Path, content: str):
+    # unchanged files keep their timestamp, so nothing is recompiled
+    if not path.is_file() or path.read_text(encoding="utf-8") != content:
+        path.write_text(content, encoding="utf-8")
+
+def generate(profile: NetProfile, out_dir: str) -> NetSizes:
+    """Raises ValueError if the profile is invalid or does not fit."""
+    sizes = size(profile)
+    out = Path(out_dir)
+    out.mkdir(parents=True, exist_ok=True)
+    _write_if_changed(out / "wchnet_sizes.h", generate_h(sizes))
+    return sizes
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Size the WCHNET memory for a RAM budget")
+    parser.add_argument("output_dir")
+    parser.add_argument("--ram", required=True, help="RAM budget, e.g. 40K")
+    parser.add_argument("--tcp", type=int, default=3, help="TCP connections")
+    parser.add_argument("--tcp-listen", type=int, default=3, help="TCP listen sockets")
+    parser.add_argument("--udp", type=int, default=1, help="UDP sockets")
+    parser.add_argument("--ipraw", type=int, default=1, help="IPRAW sockets")
+    parser.add_argument("--mss", type=int, help="TCP MSS, default 800 for ETH_DRIVER_10M, else 1460")
+    parser.add_argument("--window", type=int, help="desired TCP window in bytes")
+    parser.add_argument("--txbufs", type=int, default=ETH_TXBUFNB, help="send descriptors (ETH_TXBUFNB)")
+    parser.add_argument("--driver", default="ETH_DRIVER_10M", choices=list(ETH_DRIVERS), help="ETH_DRIVER")
+    args = parser.parse_args()
+    try:
+        sizes = generate(NetProfile(parse_size(args.ram), tcp=args.tcp, tcp_listen=args.tcp_listen,
+                                    udp=args.udp, ipraw=args.ipraw, mss=args.mss, window=args.window,
+                                    txbufs=args.txbufs, driver=args.driver), args.output_dir)
+    except ValueError as e:
+        print("Error: %s" % e, file=sys.stderr)
+        sys.exit(1)
+    print(report(sizes))
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# Generates header-only register access code from the SVD files in misc/svd:
+#   svd_regs.h   - C macros (register lvalues, field _Pos / _Msk, access helpers)
+#   svd_regs.hpp - C++ types with compile-time addresses, offsets and masks
+# Every field access compiles down to a single load / modify / store.
+# Used by noneos_sdk.py (board_build.use_svd_headers), but can also be run
+# by hand: gen_svd_headers.py misc/svd/CH32V307xx.svd output_dir
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional
+from pathlib import Path
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+@dataclass
+class SvdField:
+    name: str
+    offset: int
+    width: int
+    access: str
+    description: str
+
+@dataclass
+class SvdRegister:
+    name: str
+    offset: int
+    size: int
+    access: str
+    reset_value: int
+    description: str
+    fields: List[SvdField] = field(default_factory=list)
+
+@dataclass
+class SvdPeripheral:
+    name: str
+    base_address: int
+    description: str
+    registers: List[SvdRegister] = field(default_factory=list)
+
+def _int(text: Optional[str], default: int = 0) -> int:
+    if text is None or not text.strip():
+        return default
+    text = text.strip().lower()
+    try:
+        if text.startswith("#"):
+            return int(text[1:], 2)
+        return int(text, 0)
+    except ValueError:
+        pass
+    # some of the WCH files have hex values without prefix or placeholders like "0xEX"
+    try:
+        return int(text, 16)
+    except ValueError:
+        return default
+
+def _text(node: ET.Element, tag: str, default: str = "") -> str:
+    child = node.find(tag)
+    return " ".join(child.text.split()) if child is not None and child.text else default
+
+def _ident(name: str) -> str:
+    name = re.sub(r"[^A-Za-z0-9_]", "_", name.strip())
+    return "_" + name if name[0].isdigit() else name
+
+def _parse_field(node: ET.Element, reg_access: str) -> SvdField:
+    if node.find("bitOffset") is not None:
+        offset = _int(_text(node, "bitOffset"))
+        width = _int(_text(node, "bitWidth"), 1)
+    elif node.find("lsb") is not None:
+        offset = _int(_text(node, "lsb"))
+        width = _int(_text(node, "msb")) - offset + 1
+    else:
+        # [msb:lsb], single bits are sometimes written as [n]
+        bits = re.findall(r"\d+", _text(node, "bitRange"))
+        offset, width = int(bits[-1]), int(bits[0]) - int(bits[-1]) + 1
+    return SvdField(_ident(_text(node, "name")), offset, width,
+                    _text(node, "access", reg_access), _text(node, "description"))
+
+def parse_svd(svd_path: str) -> List[SvdPeripheral]:
+    root = ET.parse(svd_path).getroot()
+    default_size = _int(_text(root, "size"), 32)
+    default_access = _text(root, "access", "read-write")
+    by_name: Dict[str, ET.Element] = {}
+    for node in root.iter("peripheral"):
+        by_name[_text(node, "name")] = node
+    peripherals = []
+    for name, node in by_name.items():
+        reg_source = node
+        # derived peripherals (GPIOB from GPIOA, ...) share the register layout
+        while reg_source.find("registers") is None and reg_source.get("derivedFrom"):
+            reg_source = by_name[reg_source.get("derivedFrom")]
+        periph = SvdPeripheral(_ident(name), _int(_text(node, "baseAddress")),
+                               _text(node, "description", _text(reg_source, "description")))
+        seen = set()
+        for reg_node in reg_source.iter("register"):
+            reg_name = _ident(_text(reg_node, "name"))
+            offset = _int(_text(reg_node, "addressOffset"))
+            if reg_name in seen:
+                reg_name = "%s_%X" % (reg_name, offset)
+            seen.add(reg_name)
+            access = _text(reg_node, "access", default_access)
+            reg = SvdRegister(reg_name, offset, _int(_text(reg_node, "size"), default_size),
+                              access, _int(_text(reg_node, "resetValue")),
+                              _text(reg_node, "description"))
+            field_names = set()
+            for field_node in reg_node.iter("field"):
+                fld = _parse_field(field_node, access)
+                # the register and the field must not share a name in C++
+                if fld.name in field_names or fld.name == reg_name:
+                    fld.name = "%s_%d" % (fld.name, fld.offset)
+                field_names.add(fld.name)
+                reg.fields.append(fld)
+            periph.registers.append(reg)
+        peripherals.append(periph)
+    peripherals.sort(key=lambda p: p.base_address)
+    return peripherals
+
+C_TYPES = {8: "uint8_t", 16: "uint16_t", 32: "uint32_t"}
+
+def _access(access: str) -> str:
+    return {"read-only": "ro", "write-only": "wo"}.get(access, "rw")
+
+def generate_c(peripherals: List[SvdPeripheral], device: str) -> str:
+    out = [
+        "/* Generated by gen_svd_headers.py from %s, do not edit. */" % device,
+        "#ifndef __SVD_REGS_H__",
+        "#define __SVD_REGS_H__",
+        "#include <stdint.h>",
+        "",
+        "/* read-modify-write of a single field, e.g. SVD_FIELD_WRITE(SVD_GPIOA_CFGLR, SVD_GPIOA_CFGLR_MODE0, 3) */",
+        "#define SVD_FIELD_WRITE(reg, fld, val) ((reg) = ((reg) & ~fld##_Msk) | (((val) << fld##_Pos) & fld##_Msk))",
+        "#define SVD_FIELD_READ(reg, fld)       (((reg) & fld##_Msk) >> fld##_Pos)",
+        "",
+    ]
+    for p in peripherals:
+        out.append("/* %s: %s */" % (p.name, p.description))
+        out.append("#define SVD_%s_BASE 0x%08XUL" % (p.name, p.base_address))
+        for r in p.registers:
+            ctype = C_TYPES.get(r.size, "uint32_t")
+            qual = "volatile const" if _access(r.access) == "ro" else "volatile"
+            prefix = "SVD_%s_%s" % (p.name, r.name)
+            out.append("#define %s (*(%s %s *)0x%08XUL)" % (prefix, qual, ctype, p.base_address + r.offset))
+            for f in r.fields:
+                mask = ((1 << f.width) - 1) << f.offset
+                out.append("#define %s_%s_Pos %dU" % (prefix, f.name, f.offset))
+                out.append("#define %s_%s_Msk 0x%XUL" % (prefix, f.name, mask))
+        out.append("")
+    out.append("#endif /* __SVD_REGS_H__ */")
+    return "\n".join(out) + "\n"
+
+CPP_TEMPLATES = """namespace svd {
+
+enum class access { ro, wo, rw };
+
+template <typename T, uint32_t Address, access Access = access::rw>
+struct reg {
+    using type = T;
+    static constexpr uint32_t address = Address;
+    static inline volatile T &ref() { return *reinterpret_cast<volatile T *>(Address); }
+    static inline T read() {
+        static_assert(Access != access::wo, "register is write-only");
+        return ref();
+    }
+    static inline void write(T value) {
+        static_assert(Access != access::ro, "register is read-only");
+        ref() = value;
+    }
+    static inline void set_bits(T mask) { write(read() | mask); }
+    static inline void clear_bits(T mask) { write(read() & ~mask); }
+};
+
+template <typename Reg, unsigned Offset, unsigned Width, access Access = access::rw>
+struct field {
+    using type = typename Reg::type;
+    static constexpr unsigned offset = Offset;
+    static constexpr unsigned width = Width;
+    static constexpr type mask = static_cast<type>(
+        (Width >= sizeof(type) * 8 ? ~static_cast<type>(0)
+                                   : static_cast<type>((static_cast<type>(1) << Width) - 1)) << Offset);
+    /* shifted value for combining several fields into one write() */
+    static constexpr type value(type v) { return static_cast<type>((v << Offset) & mask); }
+    static inline type read() {
+        static_assert(Access != access::wo, "field is write-only");
+        return static_cast<type>((Reg::read() & mask) >> Offset);
+    }
+    static inline void write(type v) {
+        static_assert(Access != access::ro, "field is read-only");
+        Reg::ref() = static_cast<type>((Reg::ref() & ~mask) | value(v));
+    }
+    static inline void set() { write(static_cast<type>(mask >> Offset)); }
+    static inline void clear() { write(0); }
+};
+
+} // namespace svd
+"""
+
+def generate_cpp(peripherals: List[SvdPeripheral], device: str) -> str:
+    out = [
+        "/* Generated by gen_svd_headers.py from %s, do not edit. */" % device,
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+        CPP_TEMPLATES,
+        "/* peripheral namespaces are lower case to not clash with the SDK's macros (GPIOA, ...) */",
+        "namespace svd {",
+    ]
+    for p in peripherals:
+        out.append("")
+        out.append("/* %s */" % p.description)
+        out.append("namespace %s {" % p.name.lower())
+        out.append("constexpr uint32_t BASE = 0x%08XUL;" % p.base_address)
+        for r in p.registers:
+            ctype = C_TYPES.get(r.size, "uint32_t")
+            out.append("struct %s : reg<%s, BASE + 0x%X, access::%s> {" % (
+                r.name, ctype, r.offset, _access(r.access)))
+            out.append("    static constexpr %s reset_value = 0x%X;" % (
+                ctype, r.reset_value & ((1 << r.size) - 1)))
+            for f in r.fields:
+                out.append("    using %s = field<%s, %d, %d, access::%s>;" % (
+                    f.name, r.name, f.offset, f.width, _access(f.access)))
+            out.append("};")
+        out.append("} // namespace %s" % p.name.lower())
+    out.append("")
+    out.append("} // namespace svd")
+    return "\n".join(out) + "\n"
+
+def generate(svd_path: str, out_dir: str):
+    peripherals = parse_svd(svd_path)
+    device = Path(svd_path).name
+    out = Path(out_dir)
+    out.mkdir(parents=True, exist_ok=True)
+    (out / "svd_regs.h").write_text(generate_c(peripherals, device), encoding="utf-8")
+    (out / "svd_regs.hpp").write_text(generate_cpp(peripherals, device), encoding="utf-8")
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print("usage: %s <file.svd> <output dir>" % sys.argv[0])
+        sys.exit(1)
+    generate(sys.argv[1], sys.argv[2])
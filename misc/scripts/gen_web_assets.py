@@ -0,0 +1,464 @@
+#!/usr/bin/env python3
+# Generates a C table of web assets from a directory (e.g. data/www):
+#   web_assets.h - Web_Asset_t and the table declaration
+#   web_assets.c - the file contents and the table
+# Text files are minified, every file is gzip-compressed if that makes it
+# smaller, and gets a strong ETag computed from the bytes that are served.
+# A compressed file keeps an uncompressed copy (with its own ETag) for
+# clients that do not send "Accept-Encoding: gzip".
+#
+# Optionally also compiles HTML templates (e.g. data/templates): the pages
+# are split at their variables (__AXXX, e.g. __AMAC) into literal parts in
+# flash and variable slots, so the firmware streams them without scanning.
+# Each variable gets an index WEB_VAR_XXX.
+#
+# Last, a route table maps (method, path) to the file and an optional
+# handler function, with a perfect hash, so Web_FindRoute() costs one hash
+# and one string compare however many routes there are. Every file is
+# routed for GET; a routes file adds more routes, one per line:
+#   <method> <path> <file or -> [<handler>]
+# e.g. "POST /success.html success.html Web_SaveConfig". The handler is
+# called before the file is sent, with "-" it has to send the response.
+#
+# Used by _bare.py (board_build.web_assets_dir / web_templates_dir /
+# web_routes) and misc/native/native_env.py, but can also be run by hand:
+#   gen_web_assets.py data/www output_dir [--templates data/templates] [--routes data/routes.txt]
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple, Union
+import argparse
+import gzip
+import hashlib
+import re
+import sys
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".htm": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".txt": "text/plain",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".gif": "image/gif",
+    ".jpg": "image/jpeg",
+    ".jpeg": "image/jpeg",
+    ".ico": "image/x-icon",
+}
+
+@dataclass
+class WebAsset:
+    path: str
+    mime: str
+    data: bytes
+    gzip: bool
+    etag: str
+    # uncompressed copy of a gzip asset, None otherwise
+    identity: Optional["WebAsset"] = None
+
+@dataclass
+class WebTemplate:
+    path: str
+    mime: str
+    # literal text (bytes) and variable names (str), in page order
+    parts: List[Union[bytes, str]]
+
+@dataclass
+class WebRoute:
+    method: str
+    path: str
+    file: Optional[str]
+    handler: Optional[str]
+
+TEMPLATE_VAR = re.compile(r"__A([A-Z0-9]+)")
+
+# same numbers as METHOD_* of the webserver example
+METHODS = {"GET": 1, "POST": 3}
+
+def minify_html(text: str) -> str:
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    # keep the line breaks, inline scripts may rely on them
+    lines = [line.strip() for line in text.splitlines()]
+    return "\n".join(line for line in lines if line)
+
+def minify_css(text: str) -> str:
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    return text.replace(";}", "}").strip()
+
+def minify(path: Path, data: bytes) -> bytes:
+    suffix = path.suffix.lower()
+    if suffix in (".html", ".htm"):
+        return minify_html(data.decode("utf-8")).encode("utf-8")
+    if suffix == ".css":
+        return minify_css(data.decode("utf-8")).encode("utf-8")
+    if suffix in (".js", ".json", ".txt", ".svg"):
+        return data.replace(b"\r\n", b"\n")
+    return data
+
+def _etag(data: bytes) -> str:
+    return '"%s"' % hashlib.sha1(data).hexdigest()[0:16]
+
+def load_assets(src_dir: str) -> List[WebAsset]:
+    assets = []
+    root = Path(src_dir)
+    for path in sorted(p for p in root.rglob("*") if p.is_file()):
+        asset = WebAsset(
+            path=path.relative_to(root).as_posix(),
+            mime=MIME_TYPES.get(path.suffix.lower(), "application/octet-stream"),
+            data=minify(path, path.read_bytes()),
+            gzip=False,
+            etag="",
+        )
+        asset.etag = _etag(asset.data)
+        # fixed mtime, so the output (and the ETag) only depends on the content
+        compressed = gzip.compress(asset.data, compresslevel=9, mtime=0)
+        if len(compressed) < len(asset.data):
+            asset = WebAsset(asset.path, asset.mime, compressed, True, _etag(compressed), identity=asset)
+        assets.append(asset)
+    return assets
+
+def load_templates(src_dir: str) -> List[WebTemplate]:
+    templates = []
+    root = Path(src_dir)
+    for path in sorted(p for p in root.rglob("*") if p.is_file()):
+        text = minify(path, path.read_bytes()).decode("utf-8")
+        parts: List[Union[bytes, str]] = []
+        pos = 0
+        for match in TEMPLATE_VAR.finditer(text):
+            if match.start() > pos:
+                parts.append(text[pos:match.start()].encode("utf-8"))
+            parts.append(match.group(1))
+            pos = match.end()
+        if pos < len(text):
+            parts.append(text[pos:].encode("utf-8"))
+        templates.append(WebTemplate(
+            path=path.relative_to(root).as_posix(),
+            mime=MIME_TYPES.get(path.suffix.lower(), "application/octet-stream"),
+            parts=parts,
+        ))
+    return templates
+
+def template_vars(templates: List[WebTemplate]) -> List[str]:
+    return sorted({part for t in templates for part in t.parts if isinstance(part, str)})
+
+def load_routes(routes_file: Optional[str], files: List[str]) -> List[WebRoute]:
+    routes = {("GET", f): WebRoute("GET", f, f, None) for f in files}
+    if routes_file:
+        with open(routes_file, encoding="utf-8") as fp:
+            for lineno, line in enumerate(fp, 1):
+                fields = line.split("#", 1)[0].split()
+                if not fields:
+                    continue
+                where = "%s:%d" % (routes_file, lineno)
+                if len(fields) not in (3, 4):
+                    raise ValueError("%s: expected <method> <path> <file or -> [<handler>]" % where)
+                method, path, file = fields[0].upper(), fields[1].lstrip("/"), fields[2]
+                handler = fields[3] if len(fields) == 4 else None
+                if method not in METHODS:
+                    raise ValueError("%s: unknown method %s (HEAD uses the GET route)" % (where, method))
+                if file == "-":
+                    if handler is None:
+                        raise ValueError("%s: a route without file needs a handler" % where)
+                    file = None
+                elif file not in files:
+                    raise ValueError("%s: %s is not a web asset or template" % (where, file))
+                if handler is not None and not re.fullmatch(r"[A-Za-z_][A-Za-z0-9_]*", handler):
+                    raise ValueError("%s: %s is no C function name" % (where, handler))
+                routes[(method, path)] = WebRoute(method, path, file, handler)
+    return [routes[key] for key in sorted(routes)]
+
+#
+# Perfect hash of the routes (hash and displace): a first hash picks a
+# bucket, the seed of the bucket is chosen so that the second hash puts all
+# routes into different slots. Must match web_route_hash() in generate_c().
+#
+
+def route_hash(seed: int, method: int, path: str) -> int:
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for b in bytes([method]) + path.encode("utf-8"):
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    # FNV only mixes upwards, the low bits select the slot
+    h ^= h >> 16
+    h = (h * 0x045D9F3B) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+def build_route_hash(routes: List[WebRoute]) -> Tuple[List[int], List[int]]:
+    keys = [(METHODS[r.method], r.path) for r in routes]
+    num_buckets = max(1, (len(keys) + 1) // 2)
+    num_slots = 1
+    while num_slots < len(keys):
+        num_slots *= 2
+    while True:
+        buckets: Dict[int, List[int]] = {}
+        for i, key in enumerate(keys):
+            buckets.setdefault(route_hash(0, *key) % num_buckets, []).append(i)
+        seeds = [0] * num_buckets
+        slots = [0xFF] * num_slots
+        ok = True
+        for bucket, members in sorted(buckets.items(), key=lambda b: -len(b[1])):
+            for seed in range(1, 0x10000):
+                positions = [route_hash(seed, *keys[i]) & (num_slots - 1) for i in members]
+                if len(set(positions)) == len(positions) and all(slots[p] == 0xFF for p in positions):
+                    break
+            else:
+                ok = False
+                break
+            seeds[bucket] = seed
+            for i, p in zip(members, positions):
+                slots[p] = i
+        if ok:
+            return seeds, slots
+        num_slots *= 2
+
+def _c_string(text: str) -> str:
+    return '"%s"' % text.replace("\\", "\\\\").replace('"', '\\"')
+
+def _c_bytes(data: bytes) -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    return "\n".join(lines)
+
+def _c_text(data: bytes) -> str:
+    # string literal, one line per line of the page; octal escapes have a
+    # fixed length, so they can't swallow the next character
+    out, line = [], ""
+    for b in data:
+        c = chr(b)
+        if c == "\n":
+            out.append('    "%s\\n"' % line)
+            line = ""
+        elif c in '"\\':
+            line += "\\" + c
+        elif 0x20 <= b < 0x7F and c != "?":
+            line += c
+        else:
+            line += "\\%03o" % b
+    if line or not out:
+        out.append('    "%s"' % line)
+    return "\n".join(out)
+
+def generate_h(assets: List[WebAsset], templates: List[WebTemplate], routes: List[WebRoute]) -> str:
+    out = [
+        "/* Generated by gen_web_assets.py, do not edit */",
+        "#ifndef __WEB_ASSETS_H__",
+        "#define __WEB_ASSETS_H__",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "typedef struct Web_Asset",
+        "{",
+        "    const char    *path;                        //URL path without the leading '/'",
+        "    const char    *mime;                        //Content-Type",
+        "    const uint8_t *data;                        //Body as sent",
+        "    uint32_t       len;",
+        "    uint8_t        gzip;                        //Body is gzip-compressed",
+        "    const char    *etag;                        //Strong ETag, with quotes",
+        "    const struct Web_Asset *identity;           //Uncompressed copy of a gzip body, or NULL",
+        "} Web_Asset_t;",
+        "",
+        "#define WEB_ASSETS_COUNT    %d" % len(assets),
+        "",
+        "extern const Web_Asset_t web_assets[WEB_ASSETS_COUNT];",
+        "",
+    ]
+    out += [
+        "typedef struct Web_Template_Part",
+        "{",
+        "    const char    *text;                        //Literal text, NULL for a variable",
+        "    uint16_t       len;                         //Length of text",
+        "    uint8_t        var;                         //Variable (WEB_VAR_*) if text is NULL",
+        "} Web_Template_Part_t;",
+        "",
+        "typedef struct Web_Template",
+        "{",
+        "    const char    *path;                        //URL path without the leading '/'",
+        "    const char    *mime;                        //Content-Type",
+        "    const Web_Template_Part_t *parts;",
+        "    uint8_t        count;                       //Number of parts",
+        "    uint32_t       textlen;                     //Length of all literal parts",
+        "} Web_Template_t;",
+        "",
+    ]
+    if templates:
+        variables = template_vars(templates)
+        out += ["#define WEB_VAR_%-20s %d" % (name, i) for i, name in enumerate(variables)]
+        out += [
+            "#define WEB_VARS_COUNT    %d" % len(variables),
+            "",
+            "#define WEB_TEMPLATES_COUNT    %d" % len(templates),
+            "",
+            "extern const Web_Template_t web_templates[WEB_TEMPLATES_COUNT];",
+            "",
+        ]
+    out += ["#define WEB_METHOD_%-8s %d" % m for m in sorted(METHODS.items(), key=lambda m: m[1])]
+    out += [
+        "",
+        "struct _st_http_request;",
+        "typedef void (*Web_Handler_t)(uint8_t id, struct _st_http_request *request);",
+        "",
+        "typedef struct Web_Route",
+        "{",
+        "    const char    *path;                        //URL path without the leading '/'",
+        "    uint8_t        method;                      //WEB_METHOD_*",
+        "    const char    *mime;                        //Content-Type of the response",
+        "    Web_Handler_t  handler;                     //Called first, NULL if none",
+        "    const Web_Asset_t *asset;                   //File to send, or NULL",
+        "    const Web_Template_t *tpl;                  //Page to send, or NULL",
+        "} Web_Route_t;",
+        "",
+        "#define WEB_ROUTES_COUNT    %d" % len(routes),
+        "",
+        "extern const Web_Route_t web_routes[WEB_ROUTES_COUNT];",
+        "",
+        "/* route of a request, HEAD requests use the GET route */",
+        "const Web_Route_t *Web_FindRoute(uint8_t method, const char *path);",
+        "",
+        "#endif",
+        "",
+    ]
+    return "\n".join(out)
+
+def generate_c(assets: List[WebAsset], templates: List[WebTemplate], routes: List[WebRoute]) -> str:
+    out = ["/* Generated by gen_web_assets.py, do not edit */",
+           "#include <string.h>",
+           '#include "web_assets.h"', ""]
+    for i, asset in enumerate(assets):
+        out.append("/* %s, %d bytes%s */" % (asset.path, len(asset.data), ", gzip" if asset.gzip else ""))
+        out.append("static const uint8_t asset_%d[] = {" % i)
+        out.append(_c_bytes(asset.data))
+        out.append("};")
+        out.append("")
+        if asset.identity is not None:
+            identity = asset.identity
+            out.append("/* %s, %d bytes, for clients without gzip */" % (identity.path, len(identity.data)))
+            out.append("static const uint8_t asset_%d_identity_data[] = {" % i)
+            out.append(_c_bytes(identity.data))
+            out.append("};")
+            out.append("static const Web_Asset_t asset_%d_identity = {%s, %s, asset_%d_identity_data, %d, 0, %s, NULL};" % (
+                i, _c_string(identity.path), _c_string(identity.mime), i, len(identity.data),
+                _c_string(identity.etag)))
+            out.append("")
+    out.append("const Web_Asset_t web_assets[WEB_ASSETS_COUNT] = {")
+    for i, asset in enumerate(assets):
+        out.append("    {%s, %s, asset_%d, %d, %d, %s, %s}," % (
+            _c_string(asset.path), _c_string(asset.mime), i, len(asset.data),
+            1 if asset.gzip else 0, _c_string(asset.etag),
+            "&asset_%d_identity" % i if asset.identity is not None else "NULL"))
+    out.append("};")
+    if templates:
+        for i, template in enumerate(templates):
+            text = b"".join(p for p in template.parts if isinstance(p, bytes))
+            out.append("")
+            out.append("/* %s, %d bytes of text */" % (template.path, len(text)))
+            out.append("static const char template_%d_text[] =" % i)
+            out.append(_c_text(text) + ";")
+            out.append("")
+            out.append("static const Web_Template_Part_t template_%d_parts[] = {" % i)
+            offset = 0
+            for part in template.parts:
+                if isinstance(part, bytes):
+                    out.append("    {template_%d_text + %d, %d, 0}," % (i, offset, len(part)))
+                    offset += len(part)
+                else:
+                    out.append("    {NULL, 0, WEB_VAR_%s}," % part)
+            out.append("};")
+        out.append("")
+        out.append("const Web_Template_t web_templates[WEB_TEMPLATES_COUNT] = {")
+        for i, template in enumerate(templates):
+            text_len = sum(len(p) for p in template.parts if isinstance(p, bytes))
+            out.append("    {%s, %s, template_%d_parts, %d, %d}," % (
+                _c_string(template.path), _c_string(template.mime), i,
+                len(template.parts), text_len))
+        out.append("};")
+
+    asset_index = {a.path: i for i, a in enumerate(assets)}
+    template_index = {t.path: i for i, t in enumerate(templates)}
+    out.append("")
+    for handler in sorted({r.handler for r in routes if r.handler}):
+        out.append("void %s(uint8_t id, struct _st_http_request *request);" % handler)
+    out.append("")
+    out.append("const Web_Route_t web_routes[WEB_ROUTES_COUNT] = {")
+    for route in routes:
+        if route.file in asset_index:
+            mime = assets[asset_index[route.file]].mime
+            asset, tpl = "&web_assets[%d]" % asset_index[route.file], "NULL"
+        elif route.file in template_index:
+            mime = templates[template_index[route.file]].mime
+            asset, tpl = "NULL", "&web_templates[%d]" % template_index[route.file]
+        else:
+            mime, asset, tpl = "text/html", "NULL", "NULL"
+        out.append("    {%s, WEB_METHOD_%s, %s, %s, %s, %s}," % (
+            _c_string(route.path), route.method, _c_string(mime), route.handler or "NULL", asset, tpl))
+    out.append("};")
+
+    seeds, slots = build_route_hash(routes)
+    out += [
+        "",
+        "/* perfect hash of (method, path), see gen_web_assets.py */",
+        "static const uint16_t web_route_seeds[%d] = {%s};" % (len(seeds), ", ".join(str(s) for s in seeds)),
+        "static const uint8_t web_route_slots[%d] = {%s};" % (len(slots), ", ".join(str(s) for s in slots)),
+        "",
+        "static uint32_t web_route_hash(uint32_t seed, uint8_t method, const char *path)",
+        "{",
+        "    uint32_t h = 2166136261u ^ seed;",
+        "",
+        "    h = (h ^ method) * 16777619u;",
+        "    while (*path)",
+        "        h = (h ^ (uint8_t)*path++) * 16777619u;",
+        "    h ^= h >> 16;",
+        "    h *= 0x045D9F3Bu;",
+        "    return h ^ (h >> 16);",
+        "}",
+        "",
+        "const Web_Route_t *Web_FindRoute(uint8_t method, const char *path)",
+        "{",
+        "    uint16_t seed = web_route_seeds[web_route_hash(0, method, path) %% %du];" % len(seeds),
+        "    uint8_t slot = web_route_slots[web_route_hash(seed, method, path) & %du];" % (len(slots) - 1),
+        "",
+        "    if (slot == 0xFF || web_routes[slot].method != method || strcmp(web_routes[slot].path, path) != 0)",
+        "        return NULL;",
+        "    return &web_routes[slot];",
+        "}",
+    ]
+    return "\n".join(out) + "\n"
+
+def _write_if_changed(path: Path, content: str):
+    # unchanged files keep their timestamp, so nothing is recompiled
+    if not path.is_file() or path.read_text(encoding="utf-8") != content:
+        path.write_text(content, encoding="utf-8")
+
+def generate(src_dir: str, out_dir: str, template_dir: Optional[str] = None,
+             routes_file: Optional[str] = None):
+    """Raises ValueError for errors in the routes file."""
+    assets = load_assets(src_dir)
+    templates = load_templates(template_dir) if template_dir else []
+    files = [a.path for a in assets] + [t.path for t in templates]
+    if len(set(files)) != len(files):
+        raise ValueError("the same file is in the asset and in the template directory")
+    routes = load_routes(routes_file, files)
+    if len(routes) >= 0xFF:
+        raise ValueError("too many routes (%d), at most 254" % len(routes))
+    out = Path(out_dir)
+    out.mkdir(parents=True, exist_ok=True)
+    _write_if_changed(out / "web_assets.h", generate_h(assets, templates, routes))
+    _write_if_changed(out / "web_assets.c", generate_c(assets, templates, routes))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Generate the web asset, template and route tables")
+    parser.add_argument("asset_dir")
+    parser.add_argument("output_dir")
+    parser.add_argument("--templates", help="directory of the HTML templates")
+    parser.add_argument("--routes", help="file with additional routes")
+    args = parser.parse_args()
+    try:
+        generate(args.asset_dir, args.output_dir, args.templates, args.routes)
+    except ValueError as e:
+        print("Error: %s" % e, file=sys.stderr)
+        sys.exit(1)
@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+# Parses a GNU ld map file (as generated through -Wl,-Map by _bare.py) and
+# reports flash and RAM usage per section, object file, library and symbol.
+# The result can be written as JSON and compared against a saved baseline.
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional, Tuple
+from pathlib import Path
+import argparse
+import json
+import os
+import re
+import sys
+
+# non-allocated output sections that would otherwise end up at address 0
+IGNORED_SECTION_PREFIXES = (
+    ".debug", ".comment", ".riscv.attributes", ".gnu.attributes",
+    ".stab", ".note", ".line", "/DISCARD/"
+)
+
+@dataclass
+class MemoryRegion:
+    name: str
+    origin: int
+    length: int
+    attributes: str
+
+    def contains(self, address: int) -> bool:
+        return self.origin <= address < self.origin + self.length
+
+    def is_ram(self) -> bool:
+        return "w" in self.attributes.lower()
+
+@dataclass
+class InputSection:
+    name: str
+    address: int
+    size: int
+    object_file: str
+
+@dataclass
+class OutputSection:
+    name: str
+    address: int
+    size: int
+    load_address: Optional[int] = None
+    inputs: List[InputSection] = field(default_factory=list)
+
+def parse_map_file(map_text: str) -> Tuple[List[MemoryRegion], List[OutputSection]]:
+    regions: List[MemoryRegion] = []
+    sections: List[OutputSection] = []
+    state = None
+    pending_name = None
+    re_region = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s*(\S*)")
+    re_output = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$")
+    re_input = re.compile(r"^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+?)\s*$")
+    for line in map_text.splitlines():
+        if line.startswith("Memory Configuration"):
+            state = "memory"
+            continue
+        if line.startswith("Linker script and memory map"):
+            state = "map"
+            continue
+        if line.startswith("Cross Reference Table"):
+            break
+        if state == "memory":
+            m = re_region.match(line)
+            if m and m.group(1) not in ("Name", "*default*"):
+                regions.append(MemoryRegion(m.group(1), int(m.group(2), 16),
+                                            int(m.group(3), 16), m.group(4)))
+            continue
+        if state != "map" or not line.strip():
+            continue
+        # long section names are wrapped onto the next line by ld
+        if pending_name is not None:
+            line = pending_name + " " + line.lstrip()
+            pending_name = None
+        elif re.match(r"^ ?\S+$", line) and not line.strip().startswith("*"):
+            pending_name = line.rstrip()
+            continue
+        if not line.startswith(" "):
+            m = re_output.match(line)
+            if m:
+                sections.append(OutputSection(
+                    m.group(1), int(m.group(2), 16), int(m.group(3), 16),
+                    int(m.group(4), 16) if m.group(4) else None))
+            continue
+        m = re_input.match(line)
+        if m and sections and m.group(1) != "*fill*":
+            sections[-1].inputs.append(InputSection(
+                m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4)))
+    sections = [s for s in sections if not s.name.startswith(IGNORED_SECTION_PREFIXES)]
+    return regions, sections
+
+def classify(section: OutputSection, regions: List[MemoryRegion]) -> Tuple[bool, bool]:
+    """Returns (counts towards flash, counts towards RAM) for an output section."""
+    in_flash = in_ram = False
+    for region in regions:
+        if region.contains(section.address):
+            if region.is_ram():
+                in_ram = True
+            else:
+                in_flash = True
+        # initialized data is copied from flash into RAM at startup
+        if section.load_address is not None and section.load_address != section.address \
+                and region.contains(section.load_address) and not region.is_ram():
+            in_flash = True
+    return in_flash, in_ram
+
+def get_library_name(object_file: str, build_dir: str) -> str:
+    # archive members look like /path/libFrameworkNoneOSVariant.a(ch32v30x_gpio.o)
+    m = re.match(r"^(.*)\((.*)\)$", object_file)
+    if m:
+        name = os.path.basename(m.group(1))
+        if name.startswith("lib"):
+            name = name[3:]
+        return os.path.splitext(name)[0]
+    path = os.path.normpath(object_file)
+    if build_dir:
+        try:
+            rel = os.path.relpath(path, build_dir)
+            if not rel.startswith(".."):
+                first = rel.split(os.sep)[0]
+                return "user code" if first == "src" else first
+        except ValueError:
+            pass
+    return os.path.basename(os.path.dirname(path)) or "(unknown)"
+
+def get_symbol_name(input_section: InputSection) -> str:
+    # with -ffunction-sections / -fdata-sections every symbol has its own section
+    for prefix in (".text.", ".rodata.", ".data.", ".sdata.", ".bss.", ".sbss.", ".srodata."):
+        if input_section.name.startswith(prefix):
+            return input_section.name[len(prefix):]
+    return "%s(%s)" % (input_section.name, os.path.basename(input_section.object_file))
+
+def make_report(map_text: str, build_dir: str = "", top: int = 20) -> dict:
+    regions, sections = parse_map_file(map_text)
+    report = {
+        "memory": {},
+        "sections": {},
+        "libraries": {},
+        "objects": {},
+        "symbols": [],
+    }
+    flash_regions = [r for r in regions if not r.is_ram()]
+    ram_regions = [r for r in regions if r.is_ram()]
+    report["memory"]["flash"] = {"used": 0, "size": sum(r.length for r in flash_regions)}
+    report["memory"]["ram"] = {"used": 0, "size": sum(r.length for r in ram_regions)}
+    symbols = []
+
+    def add(table: dict, key: str, kind: str, size: int):
+        entry = table.setdefault(key, {"flash": 0, "ram": 0})
+        entry[kind] += size
+
+    for section in sections:
+        if section.size == 0:
+            continue
+        in_flash, in_ram = classify(section, regions)
+        kinds = [k for k, used in (("flash", in_flash), ("ram", in_ram)) if used]
+        if not kinds:
+            continue
+        # whatever is not covered by input sections is padding or linker
+        # reserved space (e.g. the .stack section)
+        rest = section.size - sum(i.size for i in section.inputs)
+        for kind in kinds:
+            report["memory"][kind]["used"] += section.size
+            add(report["sections"], section.name, kind, section.size)
+            if rest > 0:
+                add(report["libraries"], "(linker)", kind, rest)
+                add(report["objects"], "(linker)", kind, rest)
+        for input_section in section.inputs:
+            if input_section.size == 0:
+                continue
+            library = get_library_name(input_section.object_file, build_dir)
+            obj = input_section.object_file
+            if obj.endswith(")"):
+                obj = os.path.basename(obj)
+            elif build_dir:
+                try:
+                    obj = os.path.relpath(obj, build_dir)
+                except ValueError:
+                    pass
+            for kind in kinds:
+                add(report["libraries"], library, kind, input_section.size)
+                add(report["objects"], obj, kind, input_section.size)
+            symbols.append({
+                "name": get_symbol_name(input_section),
+                "section": section.name,
+                "size": input_section.size,
+                "flash": in_flash,
+                "ram": in_ram,
+            })
+    symbols.sort(key=lambda s: s["size"], reverse=True)
+    report["symbols"] = symbols[0:top]
+    return report
+
+def print_table(title: str, table: dict, limit: Optional[int] = None):
+    rows = sorted(table.items(), key=lambda kv: kv[1]["flash"] + kv[1]["ram"], reverse=True)
+    if limit:
+        rows = rows[0:limit]
+    if not rows:
+        return
+    width = max(len(title), max(len(k) for k, _ in rows))
+    print("%-*s %10s %10s" % (width, title, "Flash", "RAM"))
+    for key, entry in rows:
+        print("%-*s %10d %10d" % (width, key, entry["flash"], entry["ram"]))
+    print()
+
+def print_report(report: dict, top: int):
+    for kind in ("flash", "ram"):
+        mem = report["memory"][kind]
+        percent = 100.0 * mem["used"] / mem["size"] if mem["size"] else 0
+        print("%-6s %8d / %8d bytes (%.1f%%)" % (kind.upper() + ":", mem["used"], mem["size"], percent))
+    print()
+    print_table("Section", report["sections"])
+    print_table("Library", report["libraries"])
+    print_table("Object", report["objects"], top)
+    if report["symbols"]:
+        width = max(len("Symbol"), max(len(s["name"]) for s in report["symbols"]))
+        print("%-*s %-16s %10s" % (width, "Symbol", "Section", "Size"))
+        for sym in report["symbols"]:
+            print("%-*s %-16s %10d" % (width, sym["name"], sym["section"], sym["size"]))
+        print()
+
+def diff_tables(old: dict, new: dict) -> Dict[str, Tuple[int, int]]:
+    changes = {}
+    for key in sorted(set(old.keys()) | set(new.keys())):
+        o = old.get(key, {"flash": 0, "ram": 0})
+        n = new.get(key, {"flash": 0, "ram": 0})
+        d_flash, d_ram = n["flash"] - o["flash"], n["ram"] - o["ram"]
+        if d_flash or d_ram:
+            changes[key] = (d_flash, d_ram)
+    return changes
+
+def print_diff(baseline: dict, report: dict) -> Tuple[int, int]:
+    d_flash = report["memory"]["flash"]["used"] - baseline["memory"]["flash"]["used"]
+    d_ram = report["memory"]["ram"]["used"] - baseline["memory"]["ram"]["used"]
+    print("Difference to baseline: flash %+d bytes, RAM %+d bytes" % (d_flash, d_ram))
+    for title, key in (("Section", "sections"), ("Library", "libraries"), ("Object", "objects")):
+        changes = diff_tables(baseline.get(key, {}), report.get(key, {}))
+        if not changes:
+            continue
+        width = max(len(title), max(len(k) for k in changes))
+        print("%-*s %10s %10s" % (width, title, "Flash", "RAM"))
+        for name, (df, dr) in sorted(changes.items(), key=lambda kv: -abs(kv[1][0]) - abs(kv[1][1])):
+            print("%-*s %+10d %+10d" % (width, name, df, dr))
+        print()
+    return d_flash, d_ram
+
+def main():
+    parser = argparse.ArgumentParser(description="Flash / RAM report from a GNU ld map file")
+    parser.add_argument("map_file")
+    parser.add_argument("--build-dir", default="", help="build directory, used to shorten object paths")
+    parser.add_argument("--top", type=int, default=20, help="number of objects and symbols to show")
+    parser.add_argument("--json", dest="json_file", help="write the report to this JSON file")
+    parser.add_argument("--baseline", help="JSON report to compare against")
+    parser.add_argument("--save-baseline", action="store_true", help="store the report as new baseline")
+    parser.add_argument("--max-increase", type=int, default=-1,
+                        help="fail if flash or RAM grew by more than this many bytes over the baseline")
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.map_file):
+        print("Error: map file %s not found. Is the firmware built?" % args.map_file)
+        return 1
+    report = make_report(Path(args.map_file).read_text(encoding="utf-8", errors="replace"),
+                         os.path.abspath(args.build_dir) if args.build_dir else "", args.top)
+    print_report(report, args.top)
+    if args.json_file:
+        Path(args.json_file).write_text(json.dumps(report, indent=2), encoding="utf-8")
+        print("Report written to %s" % args.json_file)
+    if args.baseline:
+        if args.save_baseline:
+            os.makedirs(os.path.dirname(os.path.abspath(args.baseline)), exist_ok=True)
+            Path(args.baseline).write_text(json.dumps(report, indent=2), encoding="utf-8")
+            print("Baseline saved to %s" % args.baseline)
+        elif os.path.isfile(args.baseline):
+            baseline = json.loads(Path(args.baseline).read_text(encoding="utf-8"))
+            d_flash, d_ram = print_diff(baseline, report)
+            if args.max_increase >= 0 and max(d_flash, d_ram) > args.max_increase:
+                print("Error: size increase exceeds the allowed %d bytes" % args.max_increase)
+                return 1
+        else:
+            print("No baseline found at %s (save one with the size_report_save target)" % args.baseline)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# Worst-case stack depth analysis. Combines the per-function stack usage
+# emitted by GCC (-fstack-usage, *.su files) with the call graph taken from
+# the disassembly of the firmware ELF. Reports the deepest call chain for
+# main(), every *_IRQHandler and user supplied task entry functions, and
+# flags recursion, indirect calls and functions without stack information.
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional, Set
+from pathlib import Path
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+@dataclass
+class Function:
+    name: str
+    stack: Optional[int] = None
+    dynamic: bool = False
+    calls: Set[str] = field(default_factory=set)
+    indirect: bool = False
+
+@dataclass
+class StackResult:
+    depth: int
+    path: List[str]
+    recursion: bool = False
+    indirect: bool = False
+    dynamic: bool = False
+    unknown: Set[str] = field(default_factory=set)
+
+def parse_su_files(build_dir: str) -> Dict[str, Function]:
+    functions: Dict[str, Function] = {}
+    for root, _, files in os.walk(build_dir):
+        for su_file in files:
+            if not su_file.endswith(".su"):
+                continue
+            for line in Path(root, su_file).read_text(errors="replace").splitlines():
+                # main.c:42:5:main	32	static
+                parts = line.split("\t")
+                if len(parts) < 3:
+                    continue
+                name = parts[0].rsplit(":", 1)[-1]
+                # C++: "int foo(int)" -> foo
+                name = name.split("(")[0].split(" ")[-1]
+                func = functions.setdefault(name, Function(name))
+                func.stack = max(func.stack or 0, int(parts[1]))
+                func.dynamic = func.dynamic or parts[2].startswith("dynamic")
+    return functions
+
+def parse_disassembly(disasm: str, functions: Dict[str, Function]):
+    re_func = re.compile(r"^[0-9a-fA-F]+ <([^>]+)>:$")
+    re_insn = re.compile(r"^\s+[0-9a-fA-F]+:\s+(\S+)\s*([^#<]*)(?:<([^>]+)>)?")
+    current: Optional[Function] = None
+    for line in disasm.splitlines():
+        m = re_func.match(line)
+        if m:
+            current = functions.setdefault(m.group(1), Function(m.group(1)))
+            continue
+        m = re_insn.match(line)
+        if not m or current is None:
+            continue
+        mnemonic, operands, target = m.group(1), m.group(2).strip(), m.group(3)
+        if mnemonic.startswith("c."):
+            mnemonic = mnemonic[2:]
+        if mnemonic not in ("jal", "j", "jalr", "jr", "call", "tail"):
+            continue
+        if target is not None:
+            target_name = target.split("+")[0]
+            # jumps inside the function itself
+            if target_name == current.name and "+" in target:
+                continue
+            current.calls.add(target_name)
+        elif mnemonic in ("jalr", "jr") and operands not in ("ra", "zero,0(ra)", "0(ra)"):
+            current.indirect = True
+
+def analyze(name: str, functions: Dict[str, Function], memo: Dict[str, StackResult],
+            active: List[str]) -> StackResult:
+    if name in memo:
+        return memo[name]
+    func = functions.get(name)
+    # -msave-restore helpers, their stack use is part of the caller's frame
+    if name.startswith(("__riscv_save_", "__riscv_restore_")):
+        return StackResult(0, [name])
+    if func is None:
+        return StackResult(0, [name], unknown={name})
+    own = func.stack or 0
+    result = StackResult(own, [name], indirect=func.indirect, dynamic=func.dynamic,
+                         unknown=set() if func.stack is not None else {name})
+    active.append(name)
+    deepest: Optional[StackResult] = None
+    for callee in sorted(func.calls):
+        if callee in active:
+            result.recursion = True
+            continue
+        sub = analyze(callee, functions, memo, active)
+        result.recursion |= sub.recursion
+        result.indirect |= sub.indirect
+        result.dynamic |= sub.dynamic
+        result.unknown |= sub.unknown
+        if deepest is None or sub.depth > deepest.depth:
+            deepest = sub
+    active.pop()
+    if deepest is not None:
+        result.depth = own + deepest.depth
+        result.path = [name] + deepest.path
+    # results within a recursive cycle depend on the entry point
+    if not result.recursion:
+        memo[name] = result
+    return result
+
+def main():
+    parser = argparse.ArgumentParser(description="Worst-case stack depth per task and ISR")
+    parser.add_argument("elf")
+    parser.add_argument("--build-dir", required=True, help="directory with the *.su files")
+    parser.add_argument("--objdump", default="objdump")
+    parser.add_argument("--tasks", default="", help="additional entry functions (comma or space separated)")
+    parser.add_argument("--stack-size", type=int, default=0, help="configured main stack size")
+    parser.add_argument("--json", dest="json_file", help="write the results to this JSON file")
+    args = parser.parse_args()
+
+    functions = parse_su_files(args.build_dir)
+    if not functions:
+        print("Error: no *.su files found in %s, was the firmware built with -fstack-usage?" % args.build_dir)
+        return 1
+    try:
+        disasm = subprocess.run([args.objdump, "-d", "--no-show-raw-insn", args.elf],
+                                capture_output=True, text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError) as exc:
+        print("Error: failed to disassemble %s: %s" % (args.elf, exc))
+        return 1
+    parse_disassembly(disasm, functions)
+
+    roots = ["main"] + sorted(n for n in functions if n.endswith("_IRQHandler") or n.endswith("_Handler"))
+    roots += [t for t in re.split(r"[,\s]+", args.tasks) if t and t not in roots]
+    memo: Dict[str, StackResult] = {}
+    results = {}
+    width = max(len(r) for r in roots)
+    print("%-*s %8s  %s" % (width, "Entry", "Stack", "Notes"))
+    for root in roots:
+        if root not in functions:
+            print("%-*s %8s  not found in firmware" % (width, root, "-"))
+            continue
+        res = analyze(root, functions, memo, [])
+        notes = []
+        if res.recursion:
+            notes.append("RECURSION")
+        if res.indirect:
+            notes.append("indirect calls")
+        if res.dynamic:
+            notes.append("dynamic stack")
+        if res.unknown:
+            notes.append("no info: " + ", ".join(sorted(res.unknown)[0:4]) +
+                         (", ..." if len(res.unknown) > 4 else ""))
+        print("%-*s %8d  %s" % (width, root, res.depth, "; ".join(notes)))
+        print("%-*s %8s  via %s" % (width, "", "", " -> ".join(res.path)))
+        results[root] = {
+            "depth": res.depth,
+            "path": res.path,
+            "recursion": res.recursion,
+            "indirect_calls": res.indirect,
+            "dynamic": res.dynamic,
+            "unknown": sorted(res.unknown),
+        }
+    # interrupts run on the stack of whatever they interrupt
+    isr_depths = [v["depth"] for k, v in results.items() if k.endswith("Handler")]
+    if "main" in results:
+        worst = results["main"]["depth"] + (max(isr_depths) if isr_depths else 0)
+        print()
+        print("main + deepest interrupt handler: %d bytes" % worst)
+        if args.stack_size:
+            print("configured stack size: %d bytes (%s)" % (
+                args.stack_size, "OK" if worst <= args.stack_size else "POSSIBLE OVERFLOW"))
+    if args.json_file:
+        Path(args.json_file).write_text(json.dumps(results, indent=2), encoding="utf-8")
+        print("Report written to %s" % args.json_file)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
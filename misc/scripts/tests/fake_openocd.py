@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# Stands in for OpenOCD in the delta upload tests: answers the unique ID
+# read and appends the commands it was given (-c) and the Tcl scripts it
+# was asked to run (-f) to the file in $FAKE_OPENOCD_LOG.
+import os
+import sys
+
+UID = "0x1ffff7e8: 12345678 9abcdef0 0badf00d"
+
+def main():
+    log = []
+    args = sys.argv[1:]
+    for i, arg in enumerate(args[:-1]):
+        if arg == "-c":
+            log.append(args[i + 1])
+            if args[i + 1].startswith("mdw 0x1FFFF7E8"):
+                print(UID)
+        elif arg == "-f":
+            with open(args[i + 1], encoding="utf-8") as fp:
+                log.append(fp.read())
+    with open(os.environ["FAKE_OPENOCD_LOG"], "a", encoding="utf-8") as fp:
+        fp.write("\n".join(log) + "\n")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
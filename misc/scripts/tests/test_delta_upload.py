@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# Tests of delta_upload.py against fake_openocd.py:
+#   python3 -m unittest discover misc/scripts/tests
+from pathlib import Path
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import unittest
+
+TESTS_DIR = Path(__file__).resolve().parent
+DELTA_UPLOAD = TESTS_DIR.parent / "delta_upload.py"
+PAGE_SIZE = 4096
+
+class DeltaUploadOpenOCDTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.dir = Path(self.tmp.name)
+        self.log = self.dir / "openocd.log"
+        self.image = self.dir / "firmware.bin"
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def upload(self, image: bytes, *extra: str) -> str:
+        self.image.write_bytes(image)
+        if self.log.exists():
+            self.log.unlink()
+        cmd = [sys.executable, str(DELTA_UPLOAD), "--tool", "openocd", "--image", str(self.image),
+               "--page-size", str(PAGE_SIZE), "--cache-dir", str(self.dir / "cache")] + list(extra) + \
+              ["--", sys.executable, str(TESTS_DIR / "fake_openocd.py"), "-c", "init", "-c", "halt"]
+        proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True,
+                              env=dict(os.environ, FAKE_OPENOCD_LOG=str(self.log)))
+        self.assertEqual(proc.returncode, 0, proc.stdout)
+        return self.log.read_text(encoding="utf-8")
+
+    def test_first_upload_programs_the_full_image(self):
+        log = self.upload(bytes(3 * PAGE_SIZE), "--address", "0x00000000")
+        self.assertRegex(log, r"program \{[^}]*firmware\.bin\} verify reset")
+
+    def test_delta_writes_at_the_given_address(self):
+        image = bytearray(3 * PAGE_SIZE)
+        self.upload(bytes(image), "--address", "0x00000000")
+        image[PAGE_SIZE + 10] = 0x55
+        log = self.upload(bytes(image), "--address", "0x00000000")
+        self.assertEqual(re.findall(r"flash write_image erase \{[^}]*\} (0x[0-9a-f]+) bin", log), ["0x00001000"])
+        self.assertEqual(re.findall(r"verify_image \{[^}]*\} (0x[0-9a-f]+) bin", log), ["0x00000000"])
+
+    def test_delta_follows_an_offset_address(self):
+        image = bytearray(2 * PAGE_SIZE)
+        self.upload(bytes(image), "--address", "0x08000000")
+        image[0] = 0x55
+        log = self.upload(bytes(image), "--address", "0x08000000")
+        self.assertEqual(re.findall(r"flash write_image erase \{[^}]*\} (0x[0-9a-f]+) bin", log), ["0x08000000"])
+
+
+if __name__ == '__main__':
+    unittest.main()
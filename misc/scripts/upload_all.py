@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# Flashes and verifies the same firmware on several devices at once, e.g.
+# on a production line. Devices are either given as a list (WCH-Link serial
+# numbers for OpenOCD, device indices for wchisp) or enumerated through
+# "wchisp probe". Every device gets its own log file and exit code, and a
+# summary with the aggregate throughput is printed at the end.
+#
+#   upload_all.py --tool openocd --image firmware.elf --log-dir DIR \
+#       --devices "SN1, SN2" -- openocd -f wch-riscv.cfg -c init -c halt
+#
+# Everything after "--" is the tool's base command line.
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass
+from typing import List
+from pathlib import Path
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+@dataclass
+class Result:
+    device: str
+    exit_code: int
+    seconds: float
+    log_file: str
+
+def enumerate_devices(args) -> List[str]:
+    if args.devices:
+        return [d for d in re.split(r"[,\s]+", args.devices) if d]
+    if args.tool == "openocd":
+        # OpenOCD can't list the attached probes
+        return []
+    proc = subprocess.run(args.base_cmd + ["probe"], stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT, text=True)
+    # [INFO] Device #0: CH32V203C8T6[0x3119] (Code Flash: 64KiB)
+    return re.findall(r"Device #(\d+)", proc.stdout)
+
+def get_upload_cmd(args, device: str) -> List[str]:
+    if args.tool == "wchisp":
+        return args.base_cmd + ["-d", device, "flash", args.image]
+    cmd = list(args.base_cmd)
+    # select the probe before the target is initialized, and keep the
+    # parallel OpenOCD instances from fighting over the server ports
+    device_cmds = ["-c", "adapter serial %s" % device,
+                   "-c", "gdb_port disabled",
+                   "-c", "tcl_port disabled",
+                   "-c", "telnet_port disabled"]
+    pos = cmd.index("init") - 1 if "init" in cmd else len(cmd)
+    cmd[pos:pos] = device_cmds
+    if "init" not in cmd:
+        cmd += ["-c", "init", "-c", "halt"]
+    return cmd + ["-c", "program {%s} verify reset" % Path(args.image).as_posix(),
+                  "-c", "shutdown"]
+
+def upload(args, device: str) -> Result:
+    log_file = os.path.join(args.log_dir, "%s.log" % re.sub(r"[^A-Za-z0-9_.-]", "_", device))
+    cmd = get_upload_cmd(args, device)
+    start = time.time()
+    with open(log_file, "w", encoding="utf-8") as fp:
+        fp.write(" ".join(cmd) + "\n\n")
+        fp.flush()
+        try:
+            exit_code = subprocess.call(cmd, stdout=fp, stderr=subprocess.STDOUT,
+                                        timeout=args.timeout or None)
+        except subprocess.TimeoutExpired:
+            fp.write("\nTimeout after %d seconds\n" % args.timeout)
+            exit_code = -1
+        except OSError as exc:
+            fp.write("\nFailed to run %s: %s\n" % (cmd[0], exc))
+            exit_code = -1
+    result = Result(device, exit_code, time.time() - start, log_file)
+    print("[%s] %s in %.1fs" % (device, "OK" if exit_code == 0 else "FAILED (exit code %d)" % exit_code,
+                               result.seconds))
+    return result
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload the firmware to several devices in parallel")
+    parser.add_argument("--tool", choices=("openocd", "wchisp"), required=True)
+    parser.add_argument("--image", required=True)
+    parser.add_argument("--devices", default="",
+                        help="probe serial numbers (OpenOCD) or device indices (wchisp), comma or space separated")
+    parser.add_argument("--log-dir", required=True)
+    parser.add_argument("--jobs", type=int, default=0, help="parallel uploads, default: all devices")
+    parser.add_argument("--timeout", type=int, default=120, help="per device, in seconds (0: none)")
+    parser.add_argument("base_cmd", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+    if args.base_cmd and args.base_cmd[0] == "--":
+        args.base_cmd = args.base_cmd[1:]
+    if not args.base_cmd:
+        parser.error("missing tool command line after --")
+
+    devices = enumerate_devices(args)
+    if not devices:
+        if args.tool == "openocd":
+            print("Error: no devices given, set board_build.upload_all_devices to the WCH-Link serial numbers")
+        else:
+            print("Error: no devices found")
+        return 1
+    os.makedirs(args.log_dir, exist_ok=True)
+    image_size = os.path.getsize(args.image)
+    print("Uploading %s to %d device(s): %s" % (args.image, len(devices), ", ".join(devices)))
+    start = time.time()
+    with ThreadPoolExecutor(max_workers=args.jobs or len(devices)) as pool:
+        results = list(pool.map(lambda d: upload(args, d), devices))
+    total_secs = time.time() - start
+
+    width = max(len("Device"), max(len(r.device) for r in results))
+    print()
+    print("%-*s %-8s %6s %8s  %s" % (width, "Device", "Status", "Exit", "Time", "Log"))
+    for r in results:
+        print("%-*s %-8s %6d %7.1fs  %s" % (width, r.device, "OK" if r.exit_code == 0 else "FAILED",
+                                          r.exit_code, r.seconds, r.log_file))
+    ok = [r for r in results if r.exit_code == 0]
+    print()
+    print("%d of %d device(s) OK in %.1fs, %.1f KiB/s aggregate, %.1f devices/min" % (
+        len(ok), len(results), total_secs, len(ok) * image_size / 1024.0 / max(total_secs, 1e-3),
+        len(ok) * 60.0 / max(total_secs, 1e-3)))
+    return 0 if len(ok) == len(results) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())